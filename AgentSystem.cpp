@@ -0,0 +1,240 @@
+#include "AgentSystem.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const float ARRIVE_DISTANCE = 20.f;     // Assez près de la destination
+    const float REPATH_DISTANCE = 40.f;     // La destination a bougé : nouveau chemin
+    const float FOLLOW_DISTANCE = 70.f;     // Distance gardée avec l'entité suivie
+    const float FAILED_WAIT = 1.f;          // Pas de chemin : on réessaie plus tard
+    const float REJOIN_WAIT = 4.f;          // Pause avant de se remettre dans la file
+    const int WANDER_TRIES = 8;
+
+    float distance(sf::Vector2f a, sf::Vector2f b) {
+        const sf::Vector2f d = b - a;
+        return std::sqrt(d.x * d.x + d.y * d.y);
+    }
+}
+
+AgentSystem::AgentSystem(std::uint32_t seed)
+    : random_(seed)
+{
+}
+
+void AgentSystem::clear() {
+    queues_.clear();
+}
+
+void AgentSystem::reset(World& world, PathService& paths) {
+    for (AgentQueue& queue : queues_) {
+        queue.members.clear();
+        queue.timer = 0.f;
+    }
+    for (std::size_t i = 0; i < world.agents.size(); i++) {
+        Agent& agent = world.agents[i];
+        const Entity entity = world.agents.getEntity(i);
+        world.setPosition(entity, agent.home - world.bounds.get(entity).size / 2.f);
+
+        paths.release(agent.ticket);
+        agent.ticket = PathService::NO_TICKET;
+        agent.goal = agent.home;
+        agent.path.clear();
+        agent.next = 0;
+        agent.wait = 0.f;
+        if (agent.behavior == AgentBehavior::Queue && agent.queue < queues_.size()) {
+            queues_[agent.queue].members.push_back(entity);
+            agent.inQueue = true;
+        }
+    }
+}
+
+std::uint32_t AgentSystem::addQueue(sf::Vector2f head, sf::Vector2f step, float serviceTime) {
+    queues_.push_back({ head, step, serviceTime, 0.f, {} });
+    return static_cast<std::uint32_t>(queues_.size() - 1);
+}
+
+void AgentSystem::setQueue(std::uint32_t queue, sf::Vector2f head, sf::Vector2f step, float serviceTime) {
+    if (queue >= queues_.size()) return;
+    queues_[queue].head = head;
+    queues_[queue].step = step;
+    queues_[queue].serviceTime = serviceTime;
+}
+
+Agent& AgentSystem::add(World& world, Entity entity, AgentBehavior behavior, float speed) {
+    const sf::Vector2f center = world.getBounds(entity).getCenter();
+    world.agents.add(entity, { behavior, speed, center, 0.f, NO_ENTITY, 0, false, PathService::NO_TICKET, center, {}, 0, 0.f });
+    return world.agents.get(entity);
+}
+
+void AgentSystem::addWander(World& world, Entity entity, float radius, float speed) {
+    add(world, entity, AgentBehavior::Wander, speed).radius = radius;
+}
+
+void AgentSystem::addFollow(World& world, Entity entity, Entity target, float speed) {
+    add(world, entity, AgentBehavior::Follow, speed).target = target;
+}
+
+void AgentSystem::addQueue(World& world, Entity entity, std::uint32_t queue, float speed) {
+    if (queue >= queues_.size()) return;
+    Agent& agent = add(world, entity, AgentBehavior::Queue, speed);
+    agent.queue = queue;
+    agent.inQueue = true;
+    queues_[queue].members.push_back(entity);
+}
+
+void AgentSystem::remove(World& world, PathService& paths, Entity entity) {
+    if (!world.agents.has(entity)) return;
+    const Agent& agent = world.agents.get(entity);
+    paths.release(agent.ticket);
+    if (agent.behavior == AgentBehavior::Queue && agent.queue < queues_.size()) {
+        std::vector<Entity>& members = queues_[agent.queue].members;
+        members.erase(std::remove(members.begin(), members.end(), entity), members.end());
+    }
+    world.agents.remove(entity);
+}
+
+float AgentSystem::randomRange(float min, float max) {
+    return std::uniform_real_distribution<float>(min, max)(random_);
+}
+
+void AgentSystem::updateQueues(World& world, sf::Time dt) {
+    for (AgentQueue& queue : queues_) {
+        if (queue.members.empty()) continue;
+
+        // Le premier n'embarque qu'une fois arrivé devant la porte
+        const Entity head = queue.members.front();
+        if (distance(world.getBounds(head).getCenter(), queue.head) > ARRIVE_DISTANCE) continue;
+        queue.timer += dt.asSeconds();
+        if (queue.timer < queue.serviceTime) continue;
+
+        queue.timer = 0.f;
+        queue.members.erase(queue.members.begin());
+        world.agents.get(head).inQueue = false;
+    }
+}
+
+bool AgentSystem::chooseGoal(World& world, Entity entity, Agent& agent, const NavGrid& grid, sf::Vector2f center, sf::Vector2f& goal) {
+    const bool walking = agent.ticket != PathService::NO_TICKET || agent.next < agent.path.size();
+
+    switch (agent.behavior) {
+    case AgentBehavior::Wander:
+        if (walking) {
+            goal = agent.goal;
+            return true;
+        }
+        // Case libre au hasard autour de home
+        for (int i = 0; i < WANDER_TRIES; i++) {
+            const sf::Vector2f p = agent.home + sf::Vector2f(randomRange(-agent.radius, agent.radius), randomRange(-agent.radius, agent.radius));
+            const std::uint32_t cell = grid.getCell(p);
+            if (grid.isWalkable(cell)) {
+                goal = grid.getCellCenter(cell);
+                return true;
+            }
+        }
+        goal = agent.home;
+        return true;
+
+    case AgentBehavior::Follow: {
+        if (!world.transforms.has(agent.target)) return false;
+        goal = world.getBounds(agent.target).getCenter();
+        return distance(center, goal) > FOLLOW_DISTANCE;
+    }
+
+    case AgentBehavior::Queue: {
+        if (!agent.inQueue) {
+            // De retour après l'embarquement : on se remet au bout de la file
+            if (!walking && distance(center, agent.home) <= ARRIVE_DISTANCE && agent.queue < queues_.size()) {
+                queues_[agent.queue].members.push_back(entity);
+                agent.inQueue = true;
+            }
+            else {
+                goal = agent.home;
+                return true;
+            }
+        }
+        const AgentQueue& queue = queues_[agent.queue];
+        std::size_t place = 0;
+        while (place < queue.members.size() && queue.members[place] != entity) place++;
+        goal = queue.head + queue.step * static_cast<float>(place);
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+bool AgentSystem::update(World& world, const std::vector<Entity>& entities, const NavGrid& grid, PathService& paths, sf::Time dt, Entity frozen) {
+    updateQueues(world, dt);
+
+    const float seconds = dt.asSeconds();
+    bool moved = false;
+    for (Entity entity : entities) {
+        if (entity == frozen || !world.agents.has(entity)) continue;
+        Agent& agent = world.agents.get(entity);
+        if (agent.behavior == AgentBehavior::Idle) continue;
+
+        Transform& transform = world.transforms.get(entity);
+        const sf::Vector2f half = world.bounds.get(entity).size / 2.f;
+        sf::Vector2f center = transform.position + half;
+
+        // Réponse du PathService (elle peut arriver plusieurs frames après la demande)
+        if (agent.ticket != PathService::NO_TICKET && paths.getStatus(agent.ticket) != PathStatus::Pending) {
+            agent.next = 0;
+            if (!paths.take(agent.ticket, agent.path)) {
+                agent.path.clear();
+                agent.wait = FAILED_WAIT;
+            }
+            agent.ticket = PathService::NO_TICKET;
+        }
+
+        if (agent.wait > 0.f) {
+            agent.wait -= seconds;
+            continue;
+        }
+
+        sf::Vector2f goal;
+        if (!chooseGoal(world, entity, agent, grid, center, goal)) {
+            agent.path.clear();
+            agent.next = 0;
+            continue;
+        }
+
+        // Destination déplacée, ou chemin terminé sans y être : nouveau chemin
+        const bool arrived = agent.next >= agent.path.size();
+        if (agent.ticket == PathService::NO_TICKET
+            && (distance(goal, agent.goal) > REPATH_DISTANCE || (arrived && distance(center, goal) > ARRIVE_DISTANCE))) {
+            agent.goal = goal;
+            agent.ticket = paths.request(grid, center, goal);
+        }
+
+        // On avance le long du chemin, éventuellement sur plusieurs points dans la frame
+        float step = agent.speed * seconds;
+        const sf::Vector2f start = center;
+        while (step > 0.f && agent.next < agent.path.size()) {
+            const sf::Vector2f target = agent.path[agent.next];
+            const float length = distance(center, target);
+            if (length <= step) {
+                center = target;
+                step -= length;
+                agent.next++;
+
+                // Arrivée : pause avant la prochaine destination
+                if (agent.next == agent.path.size() && agent.ticket == PathService::NO_TICKET) {
+                    if (agent.behavior == AgentBehavior::Wander) agent.wait = randomRange(1.f, 3.f);
+                    else if (agent.behavior == AgentBehavior::Queue && !agent.inQueue) agent.wait = REJOIN_WAIT;
+                }
+            }
+            else {
+                center += (target - center) * (step / length);
+                step = 0.f;
+            }
+        }
+
+        if (center != start) {
+            transform.position = center - half;
+            moved = true;
+        }
+    }
+    return moved;
+}
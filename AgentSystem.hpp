@@ -0,0 +1,57 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "World.hpp"
+#include "NavGrid.hpp"
+#include "PathService.hpp"
+
+// Déplacement des NPCs qui ont un composant Agent : ils demandent leurs
+// chemins au PathService (réponse en une ou plusieurs frames) et les
+// suivent à vitesse constante.
+// - Wander : va d'un point au hasard autour de home à un autre, avec une pause
+// - Follow : reste à quelques pas de target
+// - Queue : prend sa place dans une file (porte du train) ; toutes les
+//   serviceTime secondes, le premier embarque, revient vers home, puis se
+//   remet au bout de la file
+class AgentSystem {
+public:
+    explicit AgentSystem(std::uint32_t seed = 1);
+
+    void clear();
+    // Remet chaque agent à son point de départ et reforme les files
+    void reset(World& world, PathService& paths);
+    // head : place du premier, step : décalage d'une place à la suivante
+    std::uint32_t addQueue(sf::Vector2f head, sf::Vector2f step, float serviceTime);
+    // Déplace une file existante (ses membres gardent leur place)
+    void setQueue(std::uint32_t queue, sf::Vector2f head, sf::Vector2f step, float serviceTime);
+
+    void addWander(World& world, Entity entity, float radius, float speed);
+    void addFollow(World& world, Entity entity, Entity target, float speed);
+    void addQueue(World& world, Entity entity, std::uint32_t queue, float speed);
+    // Retire le composant Agent (chemin demandé abandonné, place dans la file libérée)
+    void remove(World& world, PathService& paths, Entity entity);
+
+    // Fait avancer les agents de entities (ceux de la zone courante), sauf
+    // frozen (NPC en pleine conversation). Renvoie vrai si l'un d'eux a bougé
+    bool update(World& world, const std::vector<Entity>& entities, const NavGrid& grid, PathService& paths, sf::Time dt, Entity frozen);
+
+private:
+    struct AgentQueue {
+        sf::Vector2f head;
+        sf::Vector2f step;
+        float serviceTime;
+        float timer;
+        std::vector<Entity> members;    // Dans l'ordre de la file
+    };
+
+    Agent& add(World& world, Entity entity, AgentBehavior behavior, float speed);
+    // Destination voulue maintenant ; faux si l'agent doit rester sur place
+    bool chooseGoal(World& world, Entity entity, Agent& agent, const NavGrid& grid, sf::Vector2f center, sf::Vector2f& goal);
+    void updateQueues(World& world, sf::Time dt);
+    float randomRange(float min, float max);
+
+    std::vector<AgentQueue> queues_;
+    std::mt19937 random_;
+};
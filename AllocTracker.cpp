@@ -0,0 +1,157 @@
+#include "AllocTracker.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+
+namespace {
+    const char* const TAG_NAMES[] = {
+        "general", "donnees", "monde", "chemins", "foule", "particules",
+        "chunks", "hud", "son", "sauvegarde", "historique", "rendu", "debug"
+    };
+    static_assert(std::size(TAG_NAMES) == static_cast<std::size_t>(AllocTag::Count), "TAG_NAMES incomplet");
+
+    struct Counters {
+        std::atomic<std::uint64_t> count{ 0 };
+        std::atomic<std::uint64_t> bytes{ 0 };
+        std::atomic<std::int64_t> live{ 0 };
+        std::atomic<std::int64_t> peak{ 0 };
+    };
+
+    // Initialisés avant tout new (initialisation constante)
+    Counters tagCounters[static_cast<std::size_t>(AllocTag::Count)];
+    Counters totalCounters;
+    thread_local AllocTag threadTag = AllocTag::General;
+    thread_local std::uint64_t threadCount = 0;
+    thread_local std::uint64_t threadBytes = 0;
+
+    AllocStats read(const Counters& counters) {
+        return {
+            counters.count.load(std::memory_order_relaxed),
+            counters.bytes.load(std::memory_order_relaxed),
+            counters.live.load(std::memory_order_relaxed),
+            counters.peak.load(std::memory_order_relaxed)
+        };
+    }
+
+#ifdef NOLAN_ALLOC_TRACKING
+    // Devant chaque bloc ; garde l'alignement garanti par new
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) BlockHeader {
+        std::size_t size;
+        AllocTag tag;
+    };
+
+    void add(Counters& counters, std::size_t size) {
+        counters.count.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(size, std::memory_order_relaxed);
+        const std::int64_t live = counters.live.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed)
+            + static_cast<std::int64_t>(size);
+        std::int64_t peak = counters.peak.load(std::memory_order_relaxed);
+        while (live > peak && !counters.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    void* allocate(std::size_t size) noexcept {
+        void* memory = std::malloc(sizeof(BlockHeader) + size);
+        if (!memory) return nullptr;
+
+        const AllocTag tag = threadTag;
+        new (memory) BlockHeader{ size, tag };
+        add(tagCounters[static_cast<std::size_t>(tag)], size);
+        add(totalCounters, size);
+        if (tag != AllocTag::Debug) {
+            threadCount++;
+            threadBytes += size;
+        }
+        return static_cast<char*>(memory) + sizeof(BlockHeader);
+    }
+
+    void deallocate(void* block) noexcept {
+        if (!block) return;
+        BlockHeader* header = reinterpret_cast<BlockHeader*>(static_cast<char*>(block) - sizeof(BlockHeader));
+        const auto size = static_cast<std::int64_t>(header->size);
+        tagCounters[static_cast<std::size_t>(header->tag)].live.fetch_sub(size, std::memory_order_relaxed);
+        totalCounters.live.fetch_sub(size, std::memory_order_relaxed);
+        std::free(header);
+    }
+#endif
+}
+
+// ---------- Remplacement de new/delete ----------
+// Seules les formes sans alignement particulier : new(align_val_t) garde
+// l'allocateur standard (et n'est pas compté)
+
+#ifdef NOLAN_ALLOC_TRACKING
+void* operator new(std::size_t size) {
+    if (void* block = allocate(size)) return block;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* block = allocate(size)) return block;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void operator delete(void* block) noexcept { deallocate(block); }
+void operator delete[](void* block) noexcept { deallocate(block); }
+void operator delete(void* block, std::size_t) noexcept { deallocate(block); }
+void operator delete[](void* block, std::size_t) noexcept { deallocate(block); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { deallocate(block); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { deallocate(block); }
+#endif
+
+// ---------- AllocTracker ----------
+
+AllocTracker::Scope::Scope(AllocTag tag)
+    : previous_(threadTag)
+{
+    threadTag = tag;
+}
+
+AllocTracker::Scope::~Scope() {
+    threadTag = previous_;
+}
+
+bool AllocTracker::isEnabled() {
+#ifdef NOLAN_ALLOC_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocTracker::setThreadTag(AllocTag tag) {
+    threadTag = tag;
+}
+
+AllocTag AllocTracker::getThreadTag() {
+    return threadTag;
+}
+
+AllocStats AllocTracker::getStats(AllocTag tag) {
+    return read(tagCounters[static_cast<std::size_t>(tag)]);
+}
+
+AllocStats AllocTracker::getTotal() {
+    return read(totalCounters);
+}
+
+const char* AllocTracker::getTagName(AllocTag tag) {
+    return TAG_NAMES[static_cast<std::size_t>(tag)];
+}
+
+std::uint64_t AllocTracker::getThreadCount() {
+    return threadCount;
+}
+
+std::uint64_t AllocTracker::getThreadBytes() {
+    return threadBytes;
+}
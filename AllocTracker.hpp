@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Sous-systèmes auxquels les allocations sont attribuées
+enum class AllocTag : std::uint8_t {
+    General,    // Rien de plus précis (démarrage, Game)
+    Data,       // Lecture des fichiers, rechargement à chaud
+    World,      // Entités, déplacements, triggers
+    Paths,
+    Crowd,
+    Particles,
+    Streaming,  // Chunks du décor
+    HUD,
+    Audio,
+    Save,
+    History,    // Retour en arrière
+    Render,
+    Debug,      // Panneau de débogage : hors des compteurs par thread
+    Count
+};
+
+struct AllocStats {
+    std::uint64_t count;    // Allocations depuis le lancement
+    std::uint64_t bytes;    // Octets alloués depuis le lancement
+    std::int64_t live;      // Octets encore alloués
+    std::int64_t peak;      // Maximum de live
+};
+
+// Suivi des allocations, compilé avec NOLAN_ALLOC_TRACKING (sinon tout
+// reste à zéro). operator new/delete sont remplacés : chaque bloc garde
+// sa taille et son tag dans un en-tête, et les compteurs de chaque tag
+// sont partagés par tous les threads (atomiques). Le tag courant est
+// propre au thread : Scope le change le temps d'un appel, setThreadTag
+// une fois pour tout un thread de fond.
+// Les compteurs du thread courant (getThreadCount/Bytes) servent à compter
+// les allocations d'une frame : zéro attendu en pleine partie.
+class AllocTracker {
+public:
+    class Scope {
+    public:
+        explicit Scope(AllocTag tag);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        AllocTag previous_;
+    };
+
+    static bool isEnabled();
+
+    static void setThreadTag(AllocTag tag);
+    static AllocTag getThreadTag();
+
+    static AllocStats getStats(AllocTag tag);
+    static AllocStats getTotal();
+    static const char* getTagName(AllocTag tag);
+
+    // Allocations du thread courant depuis son lancement (sauf tag Debug)
+    static std::uint64_t getThreadCount();
+    static std::uint64_t getThreadBytes();
+};
@@ -0,0 +1,217 @@
+#include "AreaFile.hpp"
+#include "AllocTracker.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    // #RRGGBB ou #RRGGBBAA
+    bool parseColor(const std::string& text, sf::Color& color) {
+        if ((text.size() != 7 && text.size() != 9) || text[0] != '#') return false;
+        std::uint8_t channels[4] = { 0, 0, 0, 255 };
+        for (std::size_t i = 1; i < text.size(); i += 2) {
+            unsigned value = 0;
+            std::istringstream hex(text.substr(i, 2));
+            if (!(hex >> std::hex >> value)) return false;
+            channels[(i - 1) / 2] = static_cast<std::uint8_t>(value);
+        }
+        color = sf::Color(channels[0], channels[1], channels[2], channels[3]);
+        return true;
+    }
+
+    bool parseNPCType(const std::string& name, NPCType& type) {
+        for (std::size_t i = 0; i < NPC_TYPE_COUNT; i++) {
+            if (NPC_TYPE_NAMES[i] == name) {
+                type = static_cast<NPCType>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Effet facultatif en fin de sortie (fondu par défaut)
+    bool parseEffect(std::istringstream& in, TransitionEffect& effect) {
+        std::string name;
+        effect = TransitionEffect::Fade;
+        if (!(in >> name) || name == "fade") return true;
+        if (name == "wipe") effect = TransitionEffect::Wipe;
+        else if (name == "crossfade") effect = TransitionEffect::Crossfade;
+        else return false;
+        return true;
+    }
+
+    // [outline <couleur> <épaisseur>] en fin de forme
+    bool parseOutline(std::istringstream& in, sf::Color& color, float& thickness) {
+        std::string keyword, text;
+        if (!(in >> keyword)) return true;
+        return keyword == "outline" && in >> text >> thickness && parseColor(text, color);
+    }
+}
+
+bool loadAreaFile(const std::string& path, AreaData& area) {
+    AllocTracker::Scope scope(AllocTag::Data);
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Impossible de charger la zone : " << path << "\n";
+        return false;
+    }
+
+    bool ok = true;
+    bool hasSize = false;
+    int lineNumber = 0;
+    auto error = [&](const std::string& message) {
+        std::cerr << path << ":" << lineNumber << " : " << message << "\n";
+        ok = false;
+    };
+
+    std::string line;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        std::istringstream in(line);
+        std::string keyword;
+        if (!(in >> keyword) || keyword[0] == '#') continue;
+
+        if (keyword == "size") {
+            if (!(in >> area.size.x >> area.size.y) || area.size.x <= 0.f || area.size.y <= 0.f) error("taille invalide");
+            else hasSize = true;
+        }
+        else if (keyword == "background") {
+            std::string text;
+            if (!(in >> text) || !parseColor(text, area.background)) error("couleur invalide");
+        }
+        else if (keyword == "solid") {
+            area.solid = true;
+        }
+        else if (keyword == "rect" || keyword == "circle") {
+            // Même conversion que pour les formes SFML (voir DecorLayer)
+            const bool circle = keyword == "circle";
+            sf::Vector2f position, size;
+            unsigned points = 30;
+            std::string text;
+            sf::Color fill, outline;
+            float thickness = 0.f;
+            bool read = circle ? static_cast<bool>(in >> position.x >> position.y >> size.x >> points >> text)
+                               : static_cast<bool>(in >> position.x >> position.y >> size.x >> size.y >> text);
+            if (!read || !parseColor(text, fill) || !parseOutline(in, outline, thickness) || points < 3 || points > 255) {
+                error("forme invalide");
+                continue;
+            }
+            if (circle) {
+                sf::CircleShape shape(size.x, points);
+                shape.setPosition(position);
+                shape.setFillColor(fill);
+                shape.setOutlineColor(outline);
+                shape.setOutlineThickness(thickness);
+                area.decor.push_back(shape);
+            }
+            else {
+                sf::RectangleShape shape(size);
+                shape.setPosition(position);
+                shape.setFillColor(fill);
+                shape.setOutlineColor(outline);
+                shape.setOutlineThickness(thickness);
+                area.decor.push_back(shape);
+            }
+        }
+        else if (keyword == "queue") {
+            QueueDef queue;
+            if (!(in >> queue.name >> queue.head.x >> queue.head.y >> queue.step.x >> queue.step.y >> queue.serviceTime)) {
+                error("file invalide");
+                continue;
+            }
+            area.queues.push_back(queue);
+        }
+        else if (keyword == "npc") {
+            NPCDef npc{ NPCType::Passant, { 0.f, 0.f }, {}, AgentBehavior::Idle, 0.f, 0.f, {} };
+            std::string type, behavior;
+            if (!(in >> type >> npc.position.x >> npc.position.y >> npc.label) || !parseNPCType(type, npc.type)) {
+                error("NPC invalide");
+                continue;
+            }
+
+            bool valid = true;
+            if (in >> behavior) {
+                if (behavior == "wander") {
+                    npc.behavior = AgentBehavior::Wander;
+                    valid = static_cast<bool>(in >> npc.radius >> npc.speed);
+                }
+                else if (behavior == "follow") {
+                    npc.behavior = AgentBehavior::Follow;
+                    valid = static_cast<bool>(in >> npc.speed);
+                }
+                else if (behavior == "queue") {
+                    npc.behavior = AgentBehavior::Queue;
+                    valid = static_cast<bool>(in >> npc.queue >> npc.speed);
+                }
+                else {
+                    valid = false;
+                }
+            }
+            if (!valid) {
+                error("deplacement invalide pour " + npc.label);
+                continue;
+            }
+            area.npcs.push_back(npc);
+        }
+        else if (keyword == "spawn") {
+            SpawnDef spawn;
+            if (!(in >> spawn.name >> spawn.position.x >> spawn.position.y)) {
+                error("point d'arrivee invalide");
+                continue;
+            }
+            area.spawns.push_back(spawn);
+        }
+        else if (keyword == "exit") {
+            ExitDef exit;
+            if (!(in >> exit.bounds.position.x >> exit.bounds.position.y >> exit.bounds.size.x >> exit.bounds.size.y
+                     >> exit.target >> exit.spawn) || !parseEffect(in, exit.effect)) {
+                error("sortie invalide");
+                continue;
+            }
+            area.exits.push_back(exit);
+        }
+        else if (keyword == "hint") {
+            HintDef hint;
+            if (!(in >> hint.bounds.position.x >> hint.bounds.position.y >> hint.bounds.size.x >> hint.bounds.size.y >> hint.key)) {
+                error("indication invalide");
+                continue;
+            }
+            area.hints.push_back(hint);
+        }
+        else if (keyword == "crowd") {
+            CrowdDef crowd;
+            if (!(in >> crowd.spawn.position.x >> crowd.spawn.position.y >> crowd.spawn.size.x >> crowd.spawn.size.y >> crowd.goalX)) {
+                error("cortege invalide");
+                continue;
+            }
+            area.crowd = crowd;
+        }
+        else if (keyword == "obstacle") {
+            sf::FloatRect obstacle;
+            if (!(in >> obstacle.position.x >> obstacle.position.y >> obstacle.size.x >> obstacle.size.y)) {
+                error("obstacle invalide");
+                continue;
+            }
+            area.obstacles.push_back(obstacle);
+        }
+        else {
+            error("instruction inconnue : " + keyword);
+        }
+    }
+
+    if (!hasSize) {
+        lineNumber = 0;
+        error("taille manquante");
+    }
+
+    // Index du décor (chunks) et grille des NPCs
+    area.decor.buildIndex();
+    std::vector<sf::FloatRect> obstacles;
+    if (area.solid) {
+        for (const DecorShape& shape : area.decor) {
+            obstacles.push_back(DecorLayer::getBounds(shape));
+        }
+    }
+    area.grid.build(area.size, obstacles, NPC_SIZE);
+    return ok;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Decor.hpp"
+#include "NavGrid.hpp"
+#include "NPC.hpp"
+#include "Transition.hpp"
+
+// Fichier d'une zone : <AREA_DIRECTORY><zone><AREA_EXTENSION>
+const char* const AREA_DIRECTORY = "assets/areas/";
+const char* const AREA_EXTENSION = ".area";
+
+// File d'attente d'une zone (voir AgentSystem)
+struct QueueDef {
+    std::string name;
+    sf::Vector2f head;
+    sf::Vector2f step;
+    float serviceTime;
+};
+
+// NPC placé dans une zone
+struct NPCDef {
+    NPCType type;
+    sf::Vector2f position;
+    std::string label;      // Étiquette de son dialogue
+    AgentBehavior behavior;
+    float radius;           // Wander : rayon d'errance
+    float speed;
+    std::string queue;      // Queue : nom de la file
+};
+
+// Point d'arrivée du joueur dans une zone, désigné par les sorties des autres zones
+struct SpawnDef {
+    std::string name;
+    sf::Vector2f position;
+};
+
+// Sortie vers une autre zone : le joueur y apparaît au point spawn
+struct ExitDef {
+    sf::FloatRect bounds;
+    std::string target;
+    std::string spawn;
+    TransitionEffect effect;
+};
+
+// Indication affichée tant que le joueur est dans la zone
+struct HintDef {
+    sf::FloatRect bounds;
+    std::string key;        // Clé du texte (StringTable)
+};
+
+// Cortège qui traverse la zone (voir Crowd) : il naît dans spawn et
+// remonte jusqu'à goalX, à la même hauteur
+struct CrowdDef {
+    sf::FloatRect spawn;
+    float goalX;
+};
+
+// Contenu du fichier d'une zone, prêt à servir : décor indexé et grille de
+// navigation (le décor n'y est un obstacle que si la zone est solide)
+struct AreaData {
+    sf::Vector2f size;
+    sf::Color background;
+    bool solid = false;
+    DecorLayer decor;
+    NavGrid grid;
+    std::vector<QueueDef> queues;
+    std::vector<NPCDef> npcs;
+    std::vector<SpawnDef> spawns;
+    std::vector<ExitDef> exits;
+    std::vector<HintDef> hints;
+    std::vector<sf::FloatRect> obstacles;   // Infranchissables pour le cortège
+    std::optional<CrowdDef> crowd;
+};
+
+// Lit le fichier d'une zone. Les erreurs sont affichées (fichier:ligne) et
+// la fonction renvoie faux, mais les lignes correctes sont gardées.
+//
+// Syntaxe, une instruction par ligne (couleurs #RRGGBB ou #RRGGBBAA) :
+//   # commentaire
+//   size <largeur> <hauteur>
+//   background <couleur>
+//   solid                                  (le décor bloque joueur et NPCs)
+//   rect <x> <y> <largeur> <hauteur> <couleur> [outline <couleur> <épaisseur>]
+//   circle <x> <y> <rayon> <points> <couleur> [outline <couleur> <épaisseur>]
+//   queue <nom> <x> <y> <dx> <dy> <secondes>
+//   npc <type> <x> <y> <etiquette> [wander <rayon> <vitesse> | follow <vitesse> | queue <file> <vitesse>]
+//   spawn <nom> <x> <y>
+//   exit <x> <y> <largeur> <hauteur> <zone> <spawn de la zone> [fade | wipe | crossfade]
+//   hint <x> <y> <largeur> <hauteur> <clé du texte>
+//   crowd <x> <y> <largeur> <hauteur> <x d'arrivée>
+//   obstacle <x> <y> <largeur> <hauteur>   (pour le cortège seulement, rien n'est dessiné)
+// Les formes sont dessinées dans l'ordre du fichier ; follow suit le joueur.
+// Les sorties sont vérifiées par le jeu une fois toutes les zones lues.
+bool loadAreaFile(const std::string& path, AreaData& area);
@@ -0,0 +1,195 @@
+#include "AudioEngine.hpp"
+#include "AllocTracker.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    const float AUTO_FADE = 1.f; // Durée du fondu quand aucune transition ne le pilote
+}
+
+AudioEngine::AudioEngine()
+    : voiceCounter_(0)
+    , nextPending_(false)
+    , mix_(0.f)
+    , mixDriven_(false)
+    , musicVolume_(60.f)
+    , stop_(false)
+{
+    worker_ = std::thread(&AudioEngine::workerLoop, this);
+}
+
+AudioEngine::~AudioEngine() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    worker_.join();
+}
+
+void AudioEngine::push(Job job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(std::move(job));
+    }
+    wake_.notify_one();
+}
+
+void AudioEngine::loadSound(SoundId id, const std::string& path) {
+    push({ Job::Kind::LoadSound, id, path, nullptr });
+}
+
+void AudioEngine::play(SoundId id, float volume, float pitch) {
+    const std::unique_ptr<sf::SoundBuffer>& buffer = buffers_[static_cast<std::size_t>(id)];
+    if (!buffer) return; // Pas encore chargé (ou introuvable)
+
+    // Une voix libre, sinon la plus ancienne
+    Voice* voice = &voices_[0];
+    for (Voice& candidate : voices_) {
+        if (!candidate.sound || candidate.sound->getStatus() == sf::SoundSource::Status::Stopped) {
+            voice = &candidate;
+            break;
+        }
+        if (candidate.started < voice->started) voice = &candidate;
+    }
+
+    if (voice->sound) {
+        voice->sound->stop();
+        voice->sound->setBuffer(*buffer);
+    }
+    else {
+        voice->sound.emplace(*buffer);
+    }
+    voice->sound->setVolume(volume);
+    voice->sound->setPitch(pitch);
+    voice->sound->play();
+    voice->id = id;
+    voice->started = ++voiceCounter_;
+}
+
+void AudioEngine::requestMusic(const std::string& path) {
+    if (path == nextPath_) return;
+
+    // Une piste qui montait encore est abandonnée
+    dispose(std::move(next_));
+    nextPath_ = path;
+    nextPending_ = false;
+    mix_ = 0.f;
+
+    // Retour à la musique actuelle, silence, ou fichier déjà introuvable : rien à ouvrir
+    if (path == currentPath_ || path.empty() || failed_.count(path)) return;
+    nextPending_ = true;
+    push({ Job::Kind::OpenMusic, SoundId::Count, path, nullptr });
+}
+
+void AudioEngine::setMusicMix(float mix) {
+    if (nextPath_ == currentPath_) return;
+    mix_ = std::clamp(mix, 0.f, 1.f);
+    mixDriven_ = true;
+}
+
+void AudioEngine::receive() {
+    // Si le thread de fond tient le verrou, on verra ses résultats à la frame suivante
+    {
+        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+        if (!lock.owns_lock()) return;
+        received_.swap(done_);
+    }
+
+    for (Loaded& loaded : received_) {
+        if (!loaded.isMusic) {
+            if (!loaded.buffer) {
+                std::cerr << "Impossible de charger le son " << loaded.path << "\n";
+                continue;
+            }
+            // Les voix qui jouaient l'ancien tampon sont coupées avant de le remplacer
+            for (Voice& voice : voices_) {
+                if (voice.sound && voice.id == loaded.sound) voice.sound.reset();
+            }
+            buffers_[static_cast<std::size_t>(loaded.sound)] = std::move(loaded.buffer);
+            continue;
+        }
+
+        // Musique demandée puis remplacée entre-temps : on la jette
+        if (loaded.path != nextPath_ || !nextPending_) {
+            dispose(std::move(loaded.music));
+            continue;
+        }
+        nextPending_ = false;
+        if (!loaded.music) {
+            std::cerr << "Impossible d'ouvrir la musique " << loaded.path << "\n";
+            failed_.insert(loaded.path);
+            continue;
+        }
+        next_ = std::move(loaded.music);
+        next_->setLooping(true);
+        next_->setVolume(0.f);
+        next_->play();
+    }
+    received_.clear();
+}
+
+void AudioEngine::finishFade() {
+    dispose(std::move(current_));
+    current_ = std::move(next_);
+    currentPath_ = nextPath_;
+    mix_ = 0.f;
+}
+
+void AudioEngine::applyVolumes() {
+    if (current_) current_->setVolume(musicVolume_ * (1.f - mix_));
+    if (next_) next_->setVolume(musicVolume_ * mix_);
+}
+
+void AudioEngine::update(sf::Time dt) {
+    AllocTracker::Scope scope(AllocTag::Audio);
+    receive();
+
+    // La piste suivante est prête (ou c'est le silence) : fondu enchaîné
+    if (nextPath_ != currentPath_ && !nextPending_) {
+        if (!mixDriven_) mix_ = std::min(1.f, mix_ + dt.asSeconds() / AUTO_FADE);
+        if (mix_ >= 1.f) finishFade();
+    }
+    mixDriven_ = false;
+    applyVolumes();
+}
+
+void AudioEngine::dispose(std::unique_ptr<sf::Music> music) {
+    if (!music) return;
+    push({ Job::Kind::Dispose, SoundId::Count, {}, std::move(music) });
+}
+
+void AudioEngine::workerLoop() {
+    AllocTracker::setThreadTag(AllocTag::Audio);
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+            if (stop_) return;
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+
+        Loaded loaded{ job.sound, job.path, nullptr, nullptr, job.kind == Job::Kind::OpenMusic };
+        switch (job.kind) {
+        case Job::Kind::LoadSound: {
+            auto buffer = std::make_unique<sf::SoundBuffer>();
+            if (buffer->loadFromFile(job.path)) loaded.buffer = std::move(buffer);
+            break;
+        }
+        case Job::Kind::OpenMusic: {
+            auto music = std::make_unique<sf::Music>();
+            if (music->openFromFile(job.path)) loaded.music = std::move(music);
+            break;
+        }
+        case Job::Kind::Dispose:
+            job.music->stop();
+            job.music.reset();
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_.push_back(std::move(loaded));
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// Bruitages courts, chargés entièrement en mémoire
+enum class SoundId : std::uint8_t { Interact, Door, Blip, Count };
+
+// Son du jeu, sans jamais bloquer la boucle principale :
+// - les fichiers sont ouverts et chargés par un thread de fond (les
+//   bruitages au démarrage, chaque musique quand on la demande) ; un son
+//   pas encore prêt n'est simplement pas joué ;
+// - la musique de chaque zone est lue en flux (sf::Music ne garde en
+//   mémoire que quelques morceaux du fichier) ; la suivante monte pendant
+//   que la précédente s'éteint, au rythme de la transition si le jeu la
+//   pilote (setMusicMix), sinon toute seule ;
+// - les bruitages sont joués sur un nombre fixe de voix : quand toutes
+//   sont prises, la plus ancienne est coupée ;
+// - arrêter une musique peut attendre son thread de lecture : c'est le
+//   thread de fond qui s'en charge.
+class AudioEngine {
+public:
+    static constexpr std::size_t MAX_VOICES = 8;
+
+    AudioEngine();
+    ~AudioEngine();
+    AudioEngine(const AudioEngine&) = delete;
+    AudioEngine& operator=(const AudioEngine&) = delete;
+
+    void loadSound(SoundId id, const std::string& path);
+    void play(SoundId id, float volume = 100.f, float pitch = 1.f);
+
+    // Musique à mettre ensuite ("" : silence). Rien ne change si c'est déjà
+    // elle qui joue ou qui arrive
+    void requestMusic(const std::string& path);
+    // 0 : musique actuelle seule, 1 : la suivante seule. À appeler à chaque
+    // frame pendant une transition ; sans appel, le fondu se fait tout seul
+    void setMusicMix(float mix);
+    void setMusicVolume(float volume) { musicVolume_ = volume; }
+    bool isFading() const { return nextPath_ != currentPath_; }
+
+    // Récupère ce que le thread de fond a terminé et applique les volumes
+    void update(sf::Time dt);
+
+private:
+    struct Job {
+        enum class Kind { LoadSound, OpenMusic, Dispose } kind;
+        SoundId sound;
+        std::string path;
+        std::unique_ptr<sf::Music> music;   // Dispose : musique à arrêter puis détruire
+    };
+    struct Loaded {
+        SoundId sound;
+        std::string path;
+        std::unique_ptr<sf::SoundBuffer> buffer;
+        std::unique_ptr<sf::Music> music;   // Nul si le fichier n'a pas pu être ouvert
+        bool isMusic;
+    };
+    struct Voice {
+        std::optional<sf::Sound> sound;
+        SoundId id;
+        std::uint32_t started;              // Ordre de lancement (la plus ancienne est volée)
+    };
+
+    void push(Job job);
+    void receive();
+    void finishFade();
+    void applyVolumes();
+    void dispose(std::unique_ptr<sf::Music> music);
+    void workerLoop();
+
+    // Thread principal
+    std::array<std::unique_ptr<sf::SoundBuffer>, static_cast<std::size_t>(SoundId::Count)> buffers_;
+    std::array<Voice, MAX_VOICES> voices_;
+    std::uint32_t voiceCounter_;
+    std::unique_ptr<sf::Music> current_;
+    std::unique_ptr<sf::Music> next_;
+    std::string currentPath_;
+    std::string nextPath_;              // Piste demandée (ouverte ou en cours d'ouverture)
+    bool nextPending_;
+    float mix_;
+    bool mixDriven_;                    // setMusicMix appelé depuis le dernier update
+    float musicVolume_;
+    std::unordered_set<std::string> failed_; // Fichiers introuvables, signalés une seule fois
+
+    // Partagé avec le thread de fond (protégé par mutex_)
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<Job> jobs_;
+    std::vector<Loaded> done_;
+    std::vector<Loaded> received_;
+    bool stop_;
+
+    std::thread worker_;
+};
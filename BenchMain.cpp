@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include "AreaFile.hpp"
+#include "ChunkStreamer.hpp"
+#include "Crowd.hpp"
+#include "HotReload.hpp"
+#include "ParticleSystem.hpp"
+#include "PathService.hpp"
+
+// Mesure des systèmes du jeu un par un, sans fenêtre : foule, particules,
+// recherche de chemins, découpage des chunks, lecture des fichiers.
+//   nolan_bench [--iterations N] [filtre]
+// filtre : seules les mesures dont le nom le contient sont lancées.
+
+namespace {
+    const char* const AREA_NAMES[] = { "maison", "rue", "rue_manif", "gare", "train_interieur", "ecole" };
+    const sf::Time FRAME = sf::seconds(1.f / 60.f);
+
+    std::string areaPath(const char* name) {
+        return std::string(AREA_DIRECTORY) + name + AREA_EXTENSION;
+    }
+
+    // Médiane et minimum de iterations appels à fn (après un appel de chauffe)
+    void measure(const std::string& name, const std::string& filter, int iterations, const std::function<void()>& fn) {
+        if (!filter.empty() && name.find(filter) == std::string::npos) return;
+
+        using Clock = std::chrono::steady_clock;
+        fn();
+        std::vector<double> samples;
+        samples.reserve(static_cast<std::size_t>(iterations));
+        for (int i = 0; i < iterations; i++) {
+            const Clock::time_point start = Clock::now();
+            fn();
+            samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+        }
+        std::sort(samples.begin(), samples.end());
+        std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(1)
+                  << " mediane " << std::setw(10) << samples[samples.size() / 2] << " us"
+                  << "   min " << std::setw(10) << samples.front() << " us\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int iterations = 200;
+    std::string filter;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            filter = argv[i];
+        }
+    }
+
+    // Zones lues une fois (les mesures de lecture les relisent à chaque tour)
+    std::vector<std::unique_ptr<AreaData>> areas;
+    for (const char* name : AREA_NAMES) {
+        areas.push_back(std::make_unique<AreaData>());
+        if (!loadAreaFile(areaPath(name), *areas.back())) return 1;
+    }
+
+    // Foule de la manifestation, mêmes réglages que le jeu (Game::setupCrowd)
+    Crowd crowd;
+    {
+        std::vector<sf::FloatRect> obstacles;
+        obstacles.push_back(sf::FloatRect({ 0.f, 0.f }, { 800.f, 205.f }));
+        obstacles.push_back(sf::FloatRect({ 0.f, 400.f }, { 800.f, 200.f }));
+        for (int i = 0; i < 4; i++) {
+            obstacles.push_back(sf::FloatRect({ 200.f + (i * 130.f), 240.f }, { 120.f, 90.f }));
+        }
+        std::vector<sf::Vector2f> goals;
+        for (float y = 210.f; y < 400.f; y += 10.f) {
+            goals.push_back({ 795.f, y });
+        }
+        crowd.setup(areas[2]->size, obstacles, sf::FloatRect({ 0.f, 205.f }, { 30.f, 195.f }), goals, 2000);
+    }
+    const std::vector<CrowdRepeller> repellers = { { { 400.f, 300.f }, 30.f } };
+    measure("crowd.update", filter, iterations, [&] { crowd.update(FRAME, repellers); });
+
+    // Pluie de la rue (Game::setupParticles)
+    ParticleSystem particles;
+    EmitterSettings rain;
+    rain.spawn = sf::FloatRect({ -60.f, -20.f }, { 860.f, 20.f });
+    rain.rate = 2000.f;
+    rain.velocityMin = { 40.f, 480.f };
+    rain.velocityMax = { 60.f, 560.f };
+    rain.gravity = { 0.f, 0.f };
+    rain.drag = 0.f;
+    rain.lifeMin = 0.4f;
+    rain.lifeMax = 1.2f;
+    rain.sizeStart = 1.5f;
+    rain.sizeEnd = 1.5f;
+    rain.aspect = 1.f;
+    rain.streak = 0.025f;
+    rain.fadeTime = 0.1f;
+    rain.palette = { sf::Color(170, 190, 220, 170) };
+    const std::vector<ParticleSystem::EmitterId> emitters = { particles.addEmitter(rain, 2600) };
+    particles.prewarm(emitters[0], 2.f);
+    measure("particles.update", filter, iterations, [&] { particles.update(emitters, FRAME); });
+
+    // Chemins entre deux points au hasard, sans cache
+    std::mt19937 random(3);
+    for (std::size_t a = 0; a < areas.size(); a++) {
+        const AreaData& area = *areas[a];
+        PathService paths;
+        std::vector<sf::Vector2f> path;
+        std::uniform_real_distribution<float> x(0.f, area.size.x), y(0.f, area.size.y);
+        measure(std::string("path.") + AREA_NAMES[a], filter, iterations, [&] {
+            paths.clearCache();
+            PathService::Ticket ticket = paths.request(area.grid, { x(random), y(random) }, { x(random), y(random) });
+            while (paths.getStatus(ticket) == PathStatus::Pending) paths.update(sf::milliseconds(10));
+            paths.take(ticket, path);
+        });
+    }
+
+    // Maillage découpé de tous les chunks d'une zone (travail du thread des chunks)
+    for (std::size_t a = 0; a < areas.size(); a++) {
+        const AreaData& area = *areas[a];
+        sf::VertexArray mesh(sf::PrimitiveType::Triangles), scratch(sf::PrimitiveType::Triangles);
+        std::vector<std::uint32_t> visible;
+        measure(std::string("chunks.") + AREA_NAMES[a], filter, iterations, [&] {
+            for (float cy = 0.f; cy < area.size.y; cy += CHUNK_SIZE) {
+                for (float cx = 0.f; cx < area.size.x; cx += CHUNK_SIZE) {
+                    mesh.clear();
+                    area.decor.appendClippedMesh(mesh, sf::FloatRect({ cx, cy }, { CHUNK_SIZE, CHUNK_SIZE }), visible, scratch);
+                }
+            }
+        });
+    }
+
+    // Lecture des fichiers (démarrage, rechargement à chaud)
+    measure("load.areas", filter, std::max(1, iterations / 10), [&] {
+        for (const char* name : AREA_NAMES) {
+            AreaData area;
+            loadAreaFile(areaPath(name), area);
+        }
+    });
+    measure("load.texts", filter, std::max(1, iterations / 10), [&] {
+        StringTable strings;
+        DialogueScript dialogues;
+        loadTexts(strings, dialogues);
+    });
+    return 0;
+}
@@ -0,0 +1,300 @@
+#include "ChunkStreamer.hpp"
+#include "AllocTracker.hpp"
+#include "DrawStats.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Marge de préchargement autour de la vue, et marge avant déchargement
+    // (plus grande, pour ne pas recharger un chunk dès qu'on fait demi-tour)
+    const float PRELOAD_MARGIN = CHUNK_SIZE * 0.5f;
+    const float EVICT_MARGIN = CHUNK_SIZE * 1.5f;
+
+    sf::FloatRect expand(const sf::FloatRect& rect, float margin) {
+        return sf::FloatRect(
+            { rect.position.x - margin, rect.position.y - margin },
+            { rect.size.x + margin * 2.f, rect.size.y + margin * 2.f });
+    }
+
+    bool inRange(const sf::IntRect& range, sf::Vector2i coord) {
+        return coord.x >= range.position.x && coord.x < range.position.x + range.size.x
+            && coord.y >= range.position.y && coord.y < range.position.y + range.size.y;
+    }
+}
+
+ChunkStreamer::ChunkStreamer()
+    : decor_(nullptr)
+    , solid_(false)
+    , areaSize_(0.f, 0.f)
+    , generation_(0)
+    , lastGeneration_(0)
+    , prefetchDecor_(nullptr)
+    , prefetchGeneration_(0)
+    , prefetchRange_({ 0, 0 }, { 0, 0 })
+    , working_(nullptr)
+    , stop_(false)
+{
+    worker_ = std::thread(&ChunkStreamer::workerLoop, this);
+}
+
+ChunkStreamer::~ChunkStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    worker_.join();
+}
+
+sf::Vector2i ChunkStreamer::getChunkCoord(sf::Vector2f pos) {
+    return { static_cast<int>(std::floor(pos.x / CHUNK_SIZE)), static_cast<int>(std::floor(pos.y / CHUNK_SIZE)) };
+}
+
+std::uint64_t ChunkStreamer::makeKey(sf::Vector2i coord) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(coord.x)) << 32) | static_cast<std::uint32_t>(coord.y);
+}
+
+sf::FloatRect ChunkStreamer::getChunkBounds(sf::Vector2i coord) {
+    return sf::FloatRect({ coord.x * CHUNK_SIZE, coord.y * CHUNK_SIZE }, { CHUNK_SIZE, CHUNK_SIZE });
+}
+
+sf::IntRect ChunkStreamer::getChunkRange(const sf::FloatRect& rect, sf::Vector2f areaSize) {
+    // Chunks qui touchent rect, limités à la zone
+    sf::Vector2i lastChunk = getChunkCoord({ std::max(areaSize.x - 1.f, 0.f), std::max(areaSize.y - 1.f, 0.f) });
+    sf::Vector2i first = getChunkCoord(rect.position);
+    sf::Vector2i last = getChunkCoord(rect.position + rect.size);
+
+    first.x = std::max(first.x, 0);
+    first.y = std::max(first.y, 0);
+    last.x = std::min(last.x, lastChunk.x);
+    last.y = std::min(last.y, lastChunk.y);
+
+    if (last.x < first.x || last.y < first.y) return sf::IntRect({ 0, 0 }, { 0, 0 });
+    return sf::IntRect(first, { last.x - first.x + 1, last.y - first.y + 1 });
+}
+
+void ChunkStreamer::setArea(const DecorLayer* decor, bool solid, sf::Vector2f areaSize) {
+    decor_ = decor;
+    solid_ = solid;
+    areaSize_ = areaSize;
+
+    // Zone préchargée : on garde ses chunks et ses travaux en cours
+    if (decor && decor == prefetchDecor_) {
+        generation_ = prefetchGeneration_;
+        resident_.swap(prefetched_);
+        pending_.swap(prefetchPending_);
+    }
+    else {
+        generation_ = ++lastGeneration_;
+        resident_.clear();
+        pending_.clear();
+    }
+    prefetchDecor_ = nullptr;
+    prefetched_.clear();
+    prefetchPending_.clear();
+
+    // Les travaux de l'ancienne zone ne servent plus à rien
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::uint32_t generation = generation_;
+    jobs_.erase(std::remove_if(jobs_.begin(), jobs_.end(),
+        [generation](const Job& job) { return job.generation != generation; }), jobs_.end());
+    done_.erase(std::remove_if(done_.begin(), done_.end(),
+        [generation](const Result& result) { return result.generation != generation; }), done_.end());
+}
+
+void ChunkStreamer::prefetch(const DecorLayer* decor, bool solid, sf::Vector2f areaSize, const sf::FloatRect& view) {
+    AllocTracker::Scope scope(AllocTag::Streaming);
+    if (!decor || decor == decor_) return;
+
+    if (decor != prefetchDecor_) {
+        prefetchDecor_ = decor;
+        prefetchGeneration_ = ++lastGeneration_;
+        prefetched_.clear();
+        prefetchPending_.clear();
+    }
+
+    // Seulement ce que la vue d'arrivée montre : le reste viendra avec update()
+    prefetchRange_ = getChunkRange(view, areaSize);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int y = prefetchRange_.position.y; y < prefetchRange_.position.y + prefetchRange_.size.y; y++) {
+            for (int x = prefetchRange_.position.x; x < prefetchRange_.position.x + prefetchRange_.size.x; x++) {
+                std::uint64_t key = makeKey({ x, y });
+                if (prefetched_.count(key) == 0 && prefetchPending_.insert(key).second) {
+                    jobs_.push_back({ prefetchGeneration_, { x, y }, decor, solid });
+                }
+            }
+        }
+    }
+    wake_.notify_one();
+}
+
+bool ChunkStreamer::isPrefetched() const {
+    if (!prefetchDecor_) return true;
+    for (int y = prefetchRange_.position.y; y < prefetchRange_.position.y + prefetchRange_.size.y; y++) {
+        for (int x = prefetchRange_.position.x; x < prefetchRange_.position.x + prefetchRange_.size.x; x++) {
+            if (prefetched_.count(makeKey({ x, y })) == 0) return false;
+        }
+    }
+    return true;
+}
+
+void ChunkStreamer::release(const DecorLayer* decor) {
+    if (!decor) return;
+    if (decor == decor_) {
+        decor_ = nullptr;
+        resident_.clear();
+        pending_.clear();
+    }
+    if (decor == prefetchDecor_) {
+        prefetchDecor_ = nullptr;
+        prefetched_.clear();
+        prefetchPending_.clear();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    jobs_.erase(std::remove_if(jobs_.begin(), jobs_.end(),
+        [decor](const Job& job) { return job.decor == decor; }), jobs_.end());
+    idle_.wait(lock, [this, decor] { return working_ != decor; });
+}
+
+void ChunkStreamer::finish() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return jobs_.empty() && !working_; });
+}
+
+void ChunkStreamer::update(const sf::FloatRect& view) {
+    AllocTracker::Scope scope(AllocTag::Streaming);
+    // 1. Récupérer les chunks terminés par le thread de fond
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        received_.swap(done_);
+    }
+
+    sf::IntRect keep = getChunkRange(expand(view, EVICT_MARGIN), areaSize_);
+    for (auto& result : received_) {
+        std::uint64_t key = makeKey(result.chunk.coord);
+        if (prefetchDecor_ && result.generation == prefetchGeneration_) {
+            if (prefetchPending_.erase(key) != 0) prefetched_[key] = std::move(result.chunk);
+            continue;
+        }
+        if (result.generation != generation_ || pending_.erase(key) == 0) continue;
+        if (inRange(keep, result.chunk.coord)) {
+            resident_[key] = std::move(result.chunk);
+        }
+    }
+    received_.clear();
+
+    // 2. Libérer les chunks trop loin de la vue
+    for (auto it = resident_.begin(); it != resident_.end();) {
+        if (!inRange(keep, it->second.coord)) it = resident_.erase(it);
+        else ++it;
+    }
+
+    if (!decor_) return;
+
+    // 3. Demander les chunks manquants autour de la vue, les plus proches d'abord
+    requests_.clear();
+    sf::IntRect wanted = getChunkRange(expand(view, PRELOAD_MARGIN), areaSize_);
+    for (int y = wanted.position.y; y < wanted.position.y + wanted.size.y; y++) {
+        for (int x = wanted.position.x; x < wanted.position.x + wanted.size.x; x++) {
+            std::uint64_t key = makeKey({ x, y });
+            if (resident_.count(key) == 0 && pending_.count(key) == 0) {
+                requests_.push_back({ x, y });
+            }
+        }
+    }
+    if (requests_.empty()) return;
+
+    sf::Vector2f center = view.getCenter();
+    auto distance = [&center](sf::Vector2i coord) {
+        sf::Vector2f chunkCenter = getChunkBounds(coord).getCenter();
+        return (chunkCenter - center).lengthSquared();
+    };
+    std::sort(requests_.begin(), requests_.end(), [&](sf::Vector2i a, sf::Vector2i b) { return distance(a) < distance(b); });
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (sf::Vector2i coord : requests_) {
+            jobs_.push_back({ generation_, coord, decor_, solid_ });
+            pending_.insert(makeKey(coord));
+        }
+    }
+    wake_.notify_one();
+}
+
+bool ChunkStreamer::isReady(const sf::FloatRect& rect) const {
+    sf::IntRect range = getChunkRange(rect, areaSize_);
+    for (int y = range.position.y; y < range.position.y + range.size.y; y++) {
+        for (int x = range.position.x; x < range.position.x + range.size.x; x++) {
+            if (!isResident({ x, y })) return false;
+        }
+    }
+    return true;
+}
+
+bool ChunkStreamer::isResident(sf::Vector2i coord) const {
+    return resident_.count(makeKey(coord)) != 0;
+}
+
+void ChunkStreamer::draw(sf::RenderTarget& target, const sf::FloatRect& view) const {
+    for (const auto& [key, chunk] : resident_) {
+        if (chunk.bounds.findIntersection(view)) {
+            DrawStats::draw(target, chunk.mesh);
+        }
+    }
+}
+
+void ChunkStreamer::getColliders(const sf::FloatRect& rect, std::vector<sf::FloatRect>& out) const {
+    out.clear();
+    for (const auto& [key, chunk] : resident_) {
+        if (!chunk.bounds.findIntersection(rect)) continue;
+        for (const auto& collider : chunk.colliders) {
+            if (collider.findIntersection(rect)) out.push_back(collider);
+        }
+    }
+}
+
+Chunk ChunkStreamer::buildChunk(const Job& job, std::vector<std::uint32_t>& visible, sf::VertexArray& scratch) {
+    Chunk chunk;
+    chunk.coord = job.coord;
+    chunk.bounds = getChunkBounds(job.coord);
+    chunk.mesh.setPrimitiveType(sf::PrimitiveType::Triangles);
+
+    job.decor->appendClippedMesh(chunk.mesh, chunk.bounds, visible, scratch);
+
+    // Obstacles : rectangles entiers (un meuble à cheval sur deux chunks est dans les deux)
+    if (job.solid) {
+        for (std::uint32_t i : visible) {
+            chunk.colliders.push_back(DecorLayer::getBounds((*job.decor)[i]));
+        }
+    }
+    return chunk;
+}
+
+void ChunkStreamer::workerLoop() {
+    AllocTracker::setThreadTag(AllocTag::Streaming);
+    std::vector<std::uint32_t> visible;
+    sf::VertexArray scratch(sf::PrimitiveType::Triangles);
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+            if (stop_) return;
+            job = jobs_.front();
+            jobs_.pop_front();
+            working_ = job.decor;
+        }
+
+        Chunk chunk = buildChunk(job, visible, scratch);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_.push_back({ job.generation, std::move(chunk) });
+            working_ = nullptr;
+        }
+        idle_.notify_all();
+    }
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "Decor.hpp"
+
+// Taille d'un chunk du monde (en pixels)
+const float CHUNK_SIZE = 512.f;
+
+// Morceau de zone chargé en mémoire : maillage du décor et obstacles
+struct Chunk {
+    sf::Vector2i coord;
+    sf::FloatRect bounds;
+    sf::VertexArray mesh;
+    std::vector<sf::FloatRect> colliders;
+};
+
+// Découpe la zone courante en chunks de taille fixe et les charge/décharge
+// autour de la caméra. Les maillages sont construits sur un thread de fond ;
+// le thread principal ne fait que récupérer les chunks prêts dans update().
+// Le décor donné à setArea() ne doit plus être modifié pendant le streaming ;
+// pour le remplacer, setArea() avec le nouveau puis release() sur l'ancien.
+// Pendant une transition, prefetch() charge déjà les chunks visibles de la zone
+// d'arrivée ; setArea() les reprend au lieu de tout recommencer.
+class ChunkStreamer {
+public:
+    ChunkStreamer();
+    ~ChunkStreamer();
+    ChunkStreamer(const ChunkStreamer&) = delete;
+    ChunkStreamer& operator=(const ChunkStreamer&) = delete;
+
+    // Change de zone : les chunks de l'ancienne zone sont libérés
+    void setArea(const DecorLayer* decor, bool solid, sf::Vector2f areaSize);
+
+    // Précharge les chunks de la zone d'arrivée qui touchent view (sa future vue)
+    void prefetch(const DecorLayer* decor, bool solid, sf::Vector2f areaSize, const sf::FloatRect& view);
+    // Vrai quand les chunks demandés par prefetch() sont prêts
+    bool isPrefetched() const;
+
+    // Le décor va être détruit : ses travaux sont abandonnés, et si le thread
+    // de fond construit un de ses chunks on attend qu'il ait fini (un chunk au plus)
+    void release(const DecorLayer* decor);
+    // Attend que le thread de fond ait construit tous les chunks demandés
+    // (simulation sans fenêtre : le résultat ne dépend plus du temps)
+    void finish();
+
+    // Demande les chunks autour de la vue, libère ceux qui sont loin
+    // et récupère ceux que le thread de fond a terminés
+    void update(const sf::FloatRect& view);
+
+    // Vrai quand tous les chunks qui touchent rect sont chargés
+    bool isReady(const sf::FloatRect& rect) const;
+    bool isResident(sf::Vector2i coord) const;
+    bool isResident(std::uint64_t key) const { return resident_.count(key) != 0; }
+    std::size_t getResidentCount() const { return resident_.size(); }
+
+    void draw(sf::RenderTarget& target, const sf::FloatRect& view) const;
+    // Obstacles des chunks chargés qui touchent rect
+    void getColliders(const sf::FloatRect& rect, std::vector<sf::FloatRect>& out) const;
+
+    static sf::Vector2i getChunkCoord(sf::Vector2f pos);
+    static std::uint64_t makeKey(sf::Vector2i coord);
+
+private:
+    struct Job {
+        std::uint32_t generation;
+        sf::Vector2i coord;
+        const DecorLayer* decor;
+        bool solid;
+    };
+
+    struct Result {
+        std::uint32_t generation;
+        Chunk chunk;
+    };
+
+    void workerLoop();
+    static sf::IntRect getChunkRange(const sf::FloatRect& rect, sf::Vector2f areaSize);
+    static sf::FloatRect getChunkBounds(sf::Vector2i coord);
+    static Chunk buildChunk(const Job& job, std::vector<std::uint32_t>& visible, sf::VertexArray& scratch);
+
+    // Zone courante (thread principal)
+    const DecorLayer* decor_;
+    bool solid_;
+    sf::Vector2f areaSize_;
+    std::uint32_t generation_;
+    std::unordered_map<std::uint64_t, Chunk> resident_;
+    std::unordered_set<std::uint64_t> pending_;
+    std::vector<sf::Vector2i> requests_;
+    std::uint32_t lastGeneration_;
+
+    // Zone d'arrivée en préchargement (thread principal)
+    const DecorLayer* prefetchDecor_;
+    std::uint32_t prefetchGeneration_;
+    sf::IntRect prefetchRange_;
+    std::unordered_map<std::uint64_t, Chunk> prefetched_;
+    std::unordered_set<std::uint64_t> prefetchPending_;
+
+    // Partagé avec le thread de fond (protégé par mutex_)
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;      // Fin du chunk en construction
+    std::deque<Job> jobs_;
+    std::vector<Result> done_;
+    std::vector<Result> received_;
+    const DecorLayer* working_;         // Décor du chunk en construction
+    bool stop_;
+
+    std::thread worker_;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+using Entity = std::uint32_t;
+const Entity NO_ENTITY = 0xFFFFFFFFu;
+
+// Composants d'un même type rangés côte à côte (tableau dense), avec
+// l'entité de chacun. sparse_ donne la place du composant d'une entité :
+// l'accès est direct et les systèmes parcourent le tableau dense d'un bout
+// à l'autre. Retirer un composant déplace le dernier à sa place.
+template <typename T>
+class ComponentPool {
+public:
+    T& add(Entity entity, const T& component) {
+        if (entity >= sparse_.size()) sparse_.resize(entity + 1, NO_INDEX);
+        if (sparse_[entity] != NO_INDEX) return dense_[sparse_[entity]] = component;
+
+        sparse_[entity] = static_cast<std::uint32_t>(dense_.size());
+        dense_.push_back(component);
+        entities_.push_back(entity);
+        return dense_.back();
+    }
+
+    void remove(Entity entity) {
+        if (!has(entity)) return;
+        const std::uint32_t index = sparse_[entity];
+        const Entity last = entities_.back();
+
+        dense_[index] = dense_.back();
+        entities_[index] = last;
+        sparse_[last] = index;
+
+        dense_.pop_back();
+        entities_.pop_back();
+        sparse_[entity] = NO_INDEX;
+    }
+
+    void clear() {
+        dense_.clear();
+        entities_.clear();
+        sparse_.clear();
+    }
+
+    void reserve(std::size_t count) {
+        dense_.reserve(count);
+        entities_.reserve(count);
+    }
+
+    bool has(Entity entity) const { return entity < sparse_.size() && sparse_[entity] != NO_INDEX; }
+    // L'entité doit avoir le composant (voir has)
+    T& get(Entity entity) { return dense_[sparse_[entity]]; }
+    const T& get(Entity entity) const { return dense_[sparse_[entity]]; }
+
+    // Parcours linéaire : composant i et son entité
+    std::size_t size() const { return dense_.size(); }
+    T& operator[](std::size_t i) { return dense_[i]; }
+    const T& operator[](std::size_t i) const { return dense_[i]; }
+    Entity getEntity(std::size_t i) const { return entities_[i]; }
+
+private:
+    static constexpr std::uint32_t NO_INDEX = 0xFFFFFFFFu;
+
+    std::vector<T> dense_;
+    std::vector<Entity> entities_;
+    std::vector<std::uint32_t> sparse_;
+};
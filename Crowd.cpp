@@ -0,0 +1,328 @@
+#include "Crowd.hpp"
+#include "AllocTracker.hpp"
+#include "DrawStats.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const float CELL_SIZE = 10.f;           // Cases de la grille et du FlowField
+    const float RADIUS = 3.f;               // Demi-largeur d'un marcheur
+    const float SPACING = 6.5f;             // Distance voulue entre deux centres
+    const float HASH_CELL = SPACING;        // Les voisins sont dans les 3x3 cases autour
+    const float MIN_WALK_SPEED = 28.f;
+    const float MAX_WALK_SPEED = 45.f;
+    const float MAX_SPEED = 90.f;           // Bousculé, on ne va pas plus vite
+    const float STEER_RATE = 4.f;           // Vitesse à laquelle on rejoint l'allure voulue
+    const float SEPARATION_PUSH = 300.f;
+    const float REPEL_MARGIN = 25.f;        // Distance gardée autour d'un CrowdRepeller
+    const float REPEL_PUSH = 2000.f;
+    const float REPEL_SIDE = 350.f;         // Poussée de côté : la foule s'écarte au lieu de reculer
+    const unsigned MAX_WORKERS = 3;
+
+    const sf::Color SKIN_COLOR(210, 180, 140);
+    // Vêtements et pancartes
+    const sf::Color PALETTE[] = {
+        sf::Color(200, 100, 0), sf::Color(220, 60, 60), sf::Color(240, 200, 40),
+        sf::Color(60, 140, 220), sf::Color(230, 230, 230), sf::Color(120, 60, 160),
+    };
+    const int PALETTE_SIZE = static_cast<int>(sizeof(PALETTE) / sizeof(PALETTE[0]));
+
+    void appendRect(std::vector<sf::Vertex>& batch, sf::Vector2f pos, sf::Vector2f size, sf::Color color) {
+        const sf::Vector2f end = pos + size;
+        batch.push_back({ { pos.x, pos.y }, color, {} });
+        batch.push_back({ { end.x, pos.y }, color, {} });
+        batch.push_back({ { pos.x, end.y }, color, {} });
+        batch.push_back({ { pos.x, end.y }, color, {} });
+        batch.push_back({ { end.x, pos.y }, color, {} });
+        batch.push_back({ { end.x, end.y }, color, {} });
+    }
+}
+
+Crowd::Crowd(std::uint32_t seed)
+    : grid_(CELL_SIZE)
+    , random_(seed)
+    , hashMask_(0)
+    , repellers_(nullptr)
+    , sliceCount_(1)
+    , frame_(0)
+    , pending_(0)
+    , stop_(false)
+{
+    // Le thread principal calcule la première tranche, chaque thread de travail une autre
+    const unsigned cores = std::thread::hardware_concurrency();
+    const unsigned workerCount = cores > 1 ? std::min(cores - 1, MAX_WORKERS) : 0;
+    sliceCount_ = workerCount + 1;
+    for (unsigned i = 0; i < workerCount; i++) {
+        workers_.emplace_back(&Crowd::workerLoop, this, static_cast<std::size_t>(i + 1));
+    }
+}
+
+Crowd::~Crowd() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+void Crowd::setup(sf::Vector2f areaSize, const std::vector<sf::FloatRect>& obstacles,
+                  const sf::FloatRect& spawn, const std::vector<sf::Vector2f>& goals, std::size_t count) {
+    grid_.build(areaSize, obstacles, { RADIUS * 2.f, RADIUS * 2.f });
+    field_.build(grid_, goals);
+
+    // Cases d'où l'on atteint un objectif (les autres ne reçoivent personne)
+    walkCells_.clear();
+    spawnCells_.clear();
+    for (std::uint32_t cell = 0; cell < grid_.getCellCount(); cell++) {
+        const std::uint32_t cost = field_.getCost(cell);
+        if (cost == 0 || cost == FlowField::UNREACHABLE) continue;
+        walkCells_.push_back(cell);
+        if (spawn.contains(grid_.getCellCenter(cell))) spawnCells_.push_back(cell);
+    }
+    if (spawnCells_.empty()) spawnCells_ = walkCells_;
+    if (walkCells_.empty()) count = 0;
+
+    // Au départ, la manifestation occupe déjà toute la route
+    posX_.resize(count);
+    posY_.resize(count);
+    velX_.assign(count, 0.f);
+    velY_.assign(count, 0.f);
+    accX_.assign(count, 0.f);
+    accY_.assign(count, 0.f);
+    oldX_.resize(count);
+    oldY_.resize(count);
+    speed_.resize(count);
+    color_.resize(count);
+    std::uniform_real_distribution<float> speed(MIN_WALK_SPEED, MAX_WALK_SPEED);
+    std::uniform_int_distribution<int> color(0, PALETTE_SIZE - 1);
+    for (std::size_t i = 0; i < count; i++) {
+        const sf::Vector2f p = randomPointIn(walkCells_);
+        posX_[i] = p.x;
+        posY_[i] = p.y;
+        speed_[i] = speed(random_);
+        color_[i] = static_cast<std::uint8_t>(color(random_));
+    }
+
+    // Table deux fois plus grande que la foule : peu de collisions
+    std::uint32_t tableSize = 16;
+    while (tableSize < count * 2) tableSize *= 2;
+    hashMask_ = tableSize - 1;
+    cellStart_.assign(tableSize + 1, 0);
+    cursor_.assign(tableSize, 0);
+    hash_.assign(count, 0);
+    sortedX_.assign(count, 0.f);
+    sortedY_.assign(count, 0.f);
+}
+
+std::uint32_t Crowd::hashCell(int x, int y) const {
+    return ((static_cast<std::uint32_t>(x) * 73856093u) ^ (static_cast<std::uint32_t>(y) * 19349663u)) & hashMask_;
+}
+
+void Crowd::buildHash() {
+    // Tri par comptage : nombre par case, sommes cumulées, puis rangement
+    std::fill(cellStart_.begin(), cellStart_.end(), 0);
+    const std::size_t count = size();
+    for (std::size_t i = 0; i < count; i++) {
+        const std::uint32_t h = hashCell(static_cast<int>(std::floor(posX_[i] / HASH_CELL)), static_cast<int>(std::floor(posY_[i] / HASH_CELL)));
+        hash_[i] = h;
+        cellStart_[h + 1]++;
+    }
+    for (std::size_t h = 1; h < cellStart_.size(); h++) {
+        cellStart_[h] += cellStart_[h - 1];
+    }
+    std::copy(cellStart_.begin(), cellStart_.end() - 1, cursor_.begin());
+    for (std::size_t i = 0; i < count; i++) {
+        const std::uint32_t slot = cursor_[hash_[i]]++;
+        sortedX_[slot] = posX_[i];
+        sortedY_[slot] = posY_[i];
+    }
+}
+
+void Crowd::update(sf::Time dt, const std::vector<CrowdRepeller>& repellers) {
+    AllocTracker::Scope scope(AllocTag::Crowd);
+    const float seconds = dt.asSeconds();
+    if (posX_.empty() || seconds <= 0.f) return;
+
+    buildHash();
+
+    repellers_ = &repellers;
+    if (workers_.empty()) {
+        steer(0, size());
+    }
+    else {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_ = workers_.size();
+            frame_++;
+        }
+        wake_.notify_all();
+        steerSlice(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+    }
+    repellers_ = nullptr;
+
+    integrate(seconds);
+}
+
+void Crowd::steerSlice(std::size_t slice) {
+    const std::size_t count = size();
+    steer(count * slice / sliceCount_, count * (slice + 1) / sliceCount_);
+}
+
+void Crowd::steer(std::size_t begin, std::size_t end) {
+    // Ne lit que les positions et vitesses, n'écrit que accX_/accY_[begin, end)
+    const std::vector<CrowdRepeller>& repellers = *repellers_;
+    for (std::size_t i = begin; i < end; i++) {
+        const float x = posX_[i];
+        const float y = posY_[i];
+
+        // Allure voulue le long du FlowField
+        const sf::Vector2f flow = field_.getDirection(grid_.getCell({ x, y }));
+        float ax = (flow.x * speed_[i] - velX_[i]) * STEER_RATE;
+        float ay = (flow.y * speed_[i] - velY_[i]) * STEER_RATE;
+
+        // Écart avec les voisins (soi-même compris, à distance nulle : ignoré).
+        // Deux des 9 cellules peuvent tomber dans le même seau : chaque seau
+        // n'est parcouru qu'une fois, sinon ses voisins pousseraient deux fois
+        const int cx = static_cast<int>(std::floor(x / HASH_CELL));
+        const int cy = static_cast<int>(std::floor(y / HASH_CELL));
+        std::uint32_t visited[9];
+        std::size_t visitedCount = 0;
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                const std::uint32_t h = hashCell(cx + dx, cy + dy);
+                if (std::find(visited, visited + visitedCount, h) != visited + visitedCount) continue;
+                visited[visitedCount++] = h;
+                for (std::uint32_t k = cellStart_[h]; k < cellStart_[h + 1]; k++) {
+                    const float ox = x - sortedX_[k];
+                    const float oy = y - sortedY_[k];
+                    const float d2 = ox * ox + oy * oy;
+                    if (d2 >= SPACING * SPACING || d2 < 1e-6f) continue;
+                    const float d = std::sqrt(d2);
+                    const float push = SEPARATION_PUSH * (1.f - d / SPACING) / d;
+                    ax += ox * push;
+                    ay += oy * push;
+                }
+            }
+        }
+
+        // On s'écarte du joueur : on recule, et surtout on passe à côté
+        for (const CrowdRepeller& repeller : repellers) {
+            const float ox = x - repeller.center.x;
+            const float oy = y - repeller.center.y;
+            const float range = repeller.radius + REPEL_MARGIN;
+            const float d2 = ox * ox + oy * oy;
+            if (d2 >= range * range) continue;
+            const float d = std::sqrt(std::max(d2, 1e-4f));
+            const float t = 1.f - d / range;
+            ax += ox / d * REPEL_PUSH * t;
+            ay += oy / d * REPEL_PUSH * t;
+            const float side = (flow.x * oy - flow.y * ox) >= 0.f ? 1.f : -1.f;
+            ax -= flow.y * side * REPEL_SIDE * t;
+            ay += flow.x * side * REPEL_SIDE * t;
+        }
+
+        accX_[i] = ax;
+        accY_[i] = ay;
+    }
+}
+
+void Crowd::integrate(float dt) {
+    // Boucle sans branche sur des tableaux contigus : vectorisée
+    const std::size_t count = size();
+    float* px = posX_.data();
+    float* py = posY_.data();
+    float* vx = velX_.data();
+    float* vy = velY_.data();
+    const float* ax = accX_.data();
+    const float* ay = accY_.data();
+    float* ox = oldX_.data();
+    float* oy = oldY_.data();
+    for (std::size_t i = 0; i < count; i++) {
+        ox[i] = px[i];
+        oy[i] = py[i];
+        const float nvx = vx[i] + ax[i] * dt;
+        const float nvy = vy[i] + ay[i] * dt;
+        const float scale = std::min(1.f, MAX_SPEED / std::sqrt(nvx * nvx + nvy * nvy + 1e-4f));
+        vx[i] = nvx * scale;
+        vy[i] = nvy * scale;
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+    }
+
+    // Poussé dans un obstacle : on reste en place ; arrivé : on repart du début
+    for (std::size_t i = 0; i < count; i++) {
+        const std::uint32_t cell = grid_.getCell({ px[i], py[i] });
+        if (!grid_.isWalkable(cell)) {
+            px[i] = ox[i];
+            py[i] = oy[i];
+            vx[i] = 0.f;
+            vy[i] = 0.f;
+        }
+        else if (field_.getCost(cell) == 0 || field_.getCost(cell) == FlowField::UNREACHABLE) {
+            respawn(i);
+        }
+    }
+}
+
+void Crowd::respawn(std::size_t i) {
+    const sf::Vector2f p = randomPointIn(spawnCells_);
+    posX_[i] = p.x;
+    posY_[i] = p.y;
+    velX_[i] = 0.f;
+    velY_[i] = 0.f;
+}
+
+sf::Vector2f Crowd::randomPointIn(const std::vector<std::uint32_t>& cells) {
+    const std::uint32_t cell = cells[std::uniform_int_distribution<std::size_t>(0, cells.size() - 1)(random_)];
+    std::uniform_real_distribution<float> jitter(-CELL_SIZE * 0.4f, CELL_SIZE * 0.4f);
+    const float jx = jitter(random_);
+    const float jy = jitter(random_);
+    return grid_.getCellCenter(cell) + sf::Vector2f(jx, jy);
+}
+
+void Crowd::workerLoop(std::size_t slice) {
+    AllocTracker::setThreadTag(AllocTag::Crowd);
+    std::uint32_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this, seen] { return stop_ || frame_ != seen; });
+            if (stop_) return;
+            seen = frame_;
+        }
+
+        steerSlice(slice);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_--;
+        }
+        done_.notify_one();
+    }
+}
+
+void Crowd::draw(sf::RenderTarget& target, const sf::FloatRect& view) {
+    // Vus de dessus : épaules aux couleurs de la manif, tête par-dessus
+    batch_.clear();
+    const float left = view.position.x - RADIUS;
+    const float top = view.position.y - RADIUS;
+    const float right = view.position.x + view.size.x + RADIUS;
+    const float bottom = view.position.y + view.size.y + RADIUS;
+    for (std::size_t i = 0; i < size(); i++) {
+        const float x = posX_[i];
+        const float y = posY_[i];
+        if (x < left || x > right || y < top || y > bottom) continue;
+        appendRect(batch_, { x - RADIUS, y - RADIUS * 0.7f }, { RADIUS * 2.f, RADIUS * 1.4f }, PALETTE[color_[i]]);
+        appendRect(batch_, { x - RADIUS * 0.5f, y - RADIUS * 0.5f }, { RADIUS, RADIUS }, SKIN_COLOR);
+    }
+
+    if (!batch_.empty()) {
+        DrawStats::draw(target, batch_.data(), batch_.size(), sf::PrimitiveType::Triangles);
+    }
+}
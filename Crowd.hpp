@@ -0,0 +1,97 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "NavGrid.hpp"
+#include "FlowField.hpp"
+
+// Cercle que la foule contourne (le joueur, les manifestants à qui on parle)
+struct CrowdRepeller {
+    sf::Vector2f center;
+    float radius;
+};
+
+// Foule de la manifestation : des milliers de marcheurs sans composant ni
+// entité, rangés en tableaux parallèles (positions, vitesses...).
+// Chaque frame :
+// 1. une table de hachage spatiale (tri par comptage) range les marcheurs
+//    par case ;
+// 2. chacun combine la direction du FlowField, l'écart avec ses voisins et
+//    les CrowdRepeller ; ce calcul est réparti entre des threads de travail,
+//    chacun écrivant seulement l'accélération de sa tranche ;
+// 3. un seul passage sans branche sur les tableaux intègre les vitesses et
+//    les positions (vectorisé par le compilateur).
+// Arrivé à un objectif, un marcheur repart de la zone de départ.
+class Crowd {
+public:
+    explicit Crowd(std::uint32_t seed = 7);
+    ~Crowd();
+    Crowd(const Crowd&) = delete;
+    Crowd& operator=(const Crowd&) = delete;
+
+    // obstacles : ce que la foule ne traverse pas (hors de la route, barrières)
+    // spawn : zone de départ ; goals : points d'arrivée
+    void setup(sf::Vector2f areaSize, const std::vector<sf::FloatRect>& obstacles,
+               const sf::FloatRect& spawn, const std::vector<sf::Vector2f>& goals, std::size_t count);
+
+    void update(sf::Time dt, const std::vector<CrowdRepeller>& repellers);
+    // Tous les marcheurs visibles en un seul appel
+    void draw(sf::RenderTarget& target, const sf::FloatRect& view);
+
+    std::size_t size() const { return posX_.size(); }
+    std::size_t getWorkerCount() const { return workers_.size(); }
+
+private:
+    void buildHash();
+    std::uint32_t hashCell(int x, int y) const;
+    // Accélération des marcheurs [begin, end)
+    void steer(std::size_t begin, std::size_t end);
+    void steerSlice(std::size_t slice);
+    void integrate(float dt);
+    void respawn(std::size_t i);
+    sf::Vector2f randomPointIn(const std::vector<std::uint32_t>& cells);
+    void workerLoop(std::size_t slice);
+
+    NavGrid grid_;
+    FlowField field_;
+    std::vector<std::uint32_t> spawnCells_;
+    std::vector<std::uint32_t> walkCells_;
+    std::mt19937 random_;
+
+    // Un tableau par champ : les boucles lisent des float contigus
+    std::vector<float> posX_, posY_;
+    std::vector<float> velX_, velY_;
+    std::vector<float> accX_, accY_;
+    std::vector<float> oldX_, oldY_;
+    std::vector<float> speed_;
+    std::vector<std::uint8_t> color_;
+
+    // Table de hachage spatiale : positions des marcheurs de la case h dans
+    // sortedX_/sortedY_[cellStart_[h], cellStart_[h + 1]) (copiées : les
+    // voisins se lisent à la suite en mémoire)
+    std::uint32_t hashMask_;
+    std::vector<std::uint32_t> hash_;
+    std::vector<std::uint32_t> cellStart_;
+    std::vector<std::uint32_t> cursor_;
+    std::vector<float> sortedX_, sortedY_;
+
+    // Frame en cours de calcul (lue par les threads de travail)
+    const std::vector<CrowdRepeller>* repellers_;
+    std::size_t sliceCount_;
+
+    std::vector<sf::Vertex> batch_;
+
+    // Partagé avec les threads de travail (protégé par mutex_)
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::uint32_t frame_;
+    std::size_t pending_;
+    bool stop_;
+
+    std::vector<std::thread> workers_;
+};
@@ -0,0 +1,107 @@
+#include "DebugOverlay.hpp"
+#include "AllocTracker.hpp"
+#include "DrawStats.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+    const sf::Time REFRESH_INTERVAL = sf::milliseconds(250);
+    const sf::Vector2f POSITION = { 10.f, 40.f };
+    const float PADDING = 6.f;
+    const unsigned CHAR_SIZE = 13u;
+
+    float toMegabytes(std::int64_t bytes) {
+        return static_cast<float>(bytes) / (1024.f * 1024.f);
+    }
+}
+
+DebugOverlay::DebugOverlay()
+    : visible_(false)
+    , startCount_(0)
+    , startBytes_(0)
+    , frameCount_(0)
+    , frameBytes_(0)
+    , worstCount_(0)
+    , worstFrame_(sf::Time::Zero)
+    , sinceRefresh_(sf::Time::Zero)
+    , frames_(0)
+{
+    background_.setFillColor(sf::Color(0, 0, 0, 180));
+    background_.setPosition(POSITION);
+}
+
+void DebugOverlay::setFont(const sf::Font& font) {
+    AllocTracker::Scope scope(AllocTag::Debug);
+    text_.emplace(font, "", CHAR_SIZE);
+    text_->setPosition(POSITION + sf::Vector2f(PADDING, PADDING));
+}
+
+void DebugOverlay::beginFrame() {
+    startCount_ = AllocTracker::getThreadCount();
+    startBytes_ = AllocTracker::getThreadBytes();
+}
+
+void DebugOverlay::endFrame(sf::Time dt) {
+    frameCount_ = AllocTracker::getThreadCount() - startCount_;
+    frameBytes_ = AllocTracker::getThreadBytes() - startBytes_;
+    worstCount_ = std::max(worstCount_, frameCount_);
+    worstFrame_ = std::max(worstFrame_, dt);
+    sinceRefresh_ += dt;
+    frames_++;
+}
+
+void DebugOverlay::draw(sf::RenderTarget& target, std::uint32_t drawCalls) {
+    if (!visible_ || !text_) return;
+
+    // Le texte refait (et sa géométrie) ne compte pas dans la frame
+    AllocTracker::Scope scope(AllocTag::Debug);
+    if (sinceRefresh_ >= REFRESH_INTERVAL || text_->getString().isEmpty()) {
+        refresh(drawCalls);
+    }
+    DrawStats::draw(target, background_);
+    DrawStats::draw(target, *text_);
+}
+
+void DebugOverlay::refresh(std::uint32_t drawCalls) {
+    char buffer[1024];
+    std::size_t length = 0;
+    auto print = [&](const char* format, auto... args) {
+        if (length >= sizeof(buffer)) return;
+        int written = std::snprintf(buffer + length, sizeof(buffer) - length, format, args...);
+        if (written > 0) length = std::min(length + static_cast<std::size_t>(written), sizeof(buffer));
+    };
+
+    const float average = frames_ > 0 ? sinceRefresh_.asSeconds() * 1000.f / static_cast<float>(frames_) : 0.f;
+    print("frame : %.1f ms (pire %.1f ms)\n", average, worstFrame_.asSeconds() * 1000.f);
+    print("dessins : %u\n", static_cast<unsigned>(drawCalls));
+
+    if (AllocTracker::isEnabled()) {
+        print("allocations / frame : %llu (pire %llu, %llu octets)\n",
+            static_cast<unsigned long long>(frameCount_), static_cast<unsigned long long>(worstCount_),
+            static_cast<unsigned long long>(frameBytes_));
+        const AllocStats total = AllocTracker::getTotal();
+        print("tas : %.2f Mo (pic %.2f Mo)\n", toMegabytes(total.live), toMegabytes(total.peak));
+        for (std::size_t i = 0; i < static_cast<std::size_t>(AllocTag::Count); i++) {
+            const AllocStats tag = AllocTracker::getStats(static_cast<AllocTag>(i));
+            if (tag.count == 0) continue;
+            print("  %s : %.2f Mo (pic %.2f Mo), %llu allocations\n", AllocTracker::getTagName(static_cast<AllocTag>(i)),
+                toMegabytes(tag.live), toMegabytes(tag.peak), static_cast<unsigned long long>(tag.count));
+        }
+    }
+    else {
+        print("allocations : non suivies (NOLAN_ALLOC_TRACKING)\n");
+    }
+    if (length > 0 && buffer[length - 1] == '\n') length--;
+    buffer[std::min(length, sizeof(buffer) - 1)] = '\0';
+
+    // Rouge : une frame a alloué depuis le dernier affichage
+    text_->setString(buffer);
+    text_->setFillColor(worstCount_ > 0 ? sf::Color(255, 90, 90) : sf::Color::White);
+    const sf::FloatRect bounds = text_->getLocalBounds();
+    background_.setSize({ bounds.position.x + bounds.size.x + PADDING * 2.f, bounds.position.y + bounds.size.y + PADDING * 2.f });
+
+    worstCount_ = 0;
+    worstFrame_ = sf::Time::Zero;
+    sinceRefresh_ = sf::Time::Zero;
+    frames_ = 0;
+}
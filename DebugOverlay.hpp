@@ -0,0 +1,44 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <optional>
+
+// Panneau de débogage (F3), en haut à gauche de l'écran : durée des frames,
+// appels de dessin, allocations de la frame (thread principal) et mémoire
+// de chaque sous-système (voir AllocTracker).
+// En pleine partie, une frame ne doit rien allouer : le compte est en rouge
+// sinon. Le texte n'est refait que quelques fois par seconde, et ses propres
+// allocations vont au tag Debug, qui ne compte pas dans la frame.
+class DebugOverlay {
+public:
+    DebugOverlay();
+
+    void setFont(const sf::Font& font);
+    void toggle() { visible_ = !visible_; }
+    bool isVisible() const { return visible_; }
+
+    // Autour de toute la frame (événements, mise à jour, rendu)
+    void beginFrame();
+    void endFrame(sf::Time dt);
+
+    // À dessiner en dernier, en coordonnées écran. drawCalls : appels de la
+    // scène (avant le panneau)
+    void draw(sf::RenderTarget& target, std::uint32_t drawCalls);
+
+private:
+    void refresh(std::uint32_t drawCalls);
+
+    bool visible_;
+    std::optional<sf::Text> text_;
+    sf::RectangleShape background_;
+
+    // Frame en cours, puis pires valeurs depuis le dernier affichage
+    std::uint64_t startCount_;
+    std::uint64_t startBytes_;
+    std::uint64_t frameCount_;
+    std::uint64_t frameBytes_;
+    std::uint64_t worstCount_;
+    sf::Time worstFrame_;
+    sf::Time sinceRefresh_;
+    int frames_;
+};
@@ -0,0 +1,185 @@
+#include "Decor.hpp"
+#include <cmath>
+
+namespace {
+    const float PI = 3.14159265f;
+
+    void appendTriangle(sf::VertexArray& mesh, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color) {
+        mesh.append({ a, color, {} });
+        mesh.append({ b, color, {} });
+        mesh.append({ c, color, {} });
+    }
+
+    void appendQuad(sf::VertexArray& mesh, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f d, sf::Color color) {
+        appendTriangle(mesh, a, b, c, color);
+        appendTriangle(mesh, a, c, d, color);
+    }
+
+    bool containsRect(const sf::FloatRect& outer, const sf::FloatRect& inner) {
+        return inner.position.x >= outer.position.x && inner.position.y >= outer.position.y
+            && inner.position.x + inner.size.x <= outer.position.x + outer.size.x
+            && inner.position.y + inner.size.y <= outer.position.y + outer.size.y;
+    }
+
+    // Découpe d'un polygone convexe par un demi-plan (Sutherland-Hodgman).
+    // axis 0 = x, 1 = y ; keepGreater : on garde le côté >= limit
+    int clipPolygon(const sf::Vector2f* in, int count, sf::Vector2f* out, int axis, float limit, bool keepGreater) {
+        auto value = [axis](sf::Vector2f p) { return axis == 0 ? p.x : p.y; };
+        auto inside = [&](sf::Vector2f p) { return keepGreater ? value(p) >= limit : value(p) <= limit; };
+
+        int n = 0;
+        for (int i = 0; i < count; i++) {
+            sf::Vector2f a = in[i];
+            sf::Vector2f b = in[(i + 1) % count];
+            bool aIn = inside(a);
+            bool bIn = inside(b);
+
+            if (aIn) out[n++] = a;
+            if (aIn != bIn) {
+                float t = (limit - value(a)) / (value(b) - value(a));
+                out[n++] = { a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t };
+            }
+        }
+        return n;
+    }
+
+    void appendClippedTriangle(sf::VertexArray& mesh, const sf::Vertex* tri, const sf::FloatRect& clip) {
+        // Un triangle découpé par un rectangle donne au plus 7 sommets
+        sf::Vector2f bufferA[8] = { tri[0].position, tri[1].position, tri[2].position };
+        sf::Vector2f bufferB[8];
+
+        int count = 3;
+        count = clipPolygon(bufferA, count, bufferB, 0, clip.position.x, true);
+        count = clipPolygon(bufferB, count, bufferA, 0, clip.position.x + clip.size.x, false);
+        count = clipPolygon(bufferA, count, bufferB, 1, clip.position.y, true);
+        count = clipPolygon(bufferB, count, bufferA, 1, clip.position.y + clip.size.y, false);
+
+        for (int i = 1; i + 1 < count; i++) {
+            appendTriangle(mesh, bufferA[0], bufferA[i], bufferA[i + 1], tri[0].color);
+        }
+    }
+}
+
+void DecorLayer::push_back(const sf::RectangleShape& shape) {
+    DecorShape decor;
+    decor.position = shape.getPosition();
+    decor.size = shape.getSize();
+    decor.fillColor = shape.getFillColor();
+    decor.outlineColor = shape.getOutlineColor();
+    decor.outlineThickness = shape.getOutlineThickness();
+    decor.kind = DecorKind::Rect;
+    decor.pointCount = 4;
+    shapes_.push_back(decor);
+}
+
+void DecorLayer::push_back(const sf::CircleShape& shape) {
+    float radius = shape.getRadius();
+
+    DecorShape decor;
+    decor.position = shape.getPosition();
+    decor.size = { radius * 2.f, radius * 2.f };
+    decor.fillColor = shape.getFillColor();
+    decor.outlineColor = shape.getOutlineColor();
+    decor.outlineThickness = shape.getOutlineThickness();
+    decor.kind = DecorKind::Circle;
+    decor.pointCount = static_cast<std::uint8_t>(shape.getPointCount());
+    shapes_.push_back(decor);
+}
+
+sf::FloatRect DecorLayer::getBounds(const DecorShape& shape) {
+    return sf::FloatRect(shape.position, shape.size);
+}
+
+sf::FloatRect DecorLayer::getDrawBounds(const DecorShape& shape) {
+    // Le contour déborde d'au plus 2 * épaisseur (pointes des petits polygones)
+    float margin = std::abs(shape.outlineThickness) * 2.f;
+    return sf::FloatRect(
+        { shape.position.x - margin, shape.position.y - margin },
+        { shape.size.x + margin * 2.f, shape.size.y + margin * 2.f });
+}
+
+void DecorLayer::buildIndex() {
+    std::vector<sf::FloatRect> bounds;
+    bounds.reserve(shapes_.size());
+    for (const auto& shape : shapes_) {
+        bounds.push_back(getDrawBounds(shape));
+    }
+    index_.build(bounds);
+}
+
+void DecorLayer::appendMesh(sf::VertexArray& mesh) const {
+    for (const auto& shape : shapes_) {
+        appendShape(mesh, shape);
+    }
+}
+
+void DecorLayer::appendClippedMesh(sf::VertexArray& mesh, const sf::FloatRect& area, std::vector<std::uint32_t>& visible, sf::VertexArray& scratch) const {
+    index_.query(area, visible);
+    for (std::uint32_t i : visible) {
+        const DecorShape& shape = shapes_[i];
+
+        // Cas courant : la forme est entièrement dans la zone, rien à découper
+        if (containsRect(area, getDrawBounds(shape))) {
+            appendShape(mesh, shape);
+            continue;
+        }
+
+        scratch.clear();
+        appendShape(scratch, shape);
+        for (std::size_t v = 0; v + 2 < scratch.getVertexCount(); v += 3) {
+            appendClippedTriangle(mesh, &scratch[v], area);
+        }
+    }
+}
+
+void DecorLayer::appendShape(sf::VertexArray& mesh, const DecorShape& shape) {
+    const float t = shape.outlineThickness;
+    const bool hasFill = shape.fillColor.a > 0;
+    const bool hasOutline = t != 0.f && shape.outlineColor.a > 0;
+
+    if (shape.kind == DecorKind::Rect) {
+        sf::Vector2f tl = shape.position;
+        sf::Vector2f br = { tl.x + shape.size.x, tl.y + shape.size.y };
+
+        if (hasFill) {
+            appendQuad(mesh, tl, { br.x, tl.y }, br, { tl.x, br.y }, shape.fillColor);
+        }
+
+        if (hasOutline) {
+            // Cadre autour du rectangle (le contour SFML déborde vers l'extérieur)
+            sf::Vector2f otl = { tl.x - t, tl.y - t };
+            sf::Vector2f obr = { br.x + t, br.y + t };
+            appendQuad(mesh, otl, { obr.x, otl.y }, { br.x, tl.y }, tl, shape.outlineColor);
+            appendQuad(mesh, { br.x, tl.y }, { obr.x, otl.y }, obr, br, shape.outlineColor);
+            appendQuad(mesh, { tl.x, br.y }, br, obr, { otl.x, obr.y }, shape.outlineColor);
+            appendQuad(mesh, otl, tl, { tl.x, br.y }, { otl.x, obr.y }, shape.outlineColor);
+        }
+        return;
+    }
+
+    // Cercle : polygone régulier, mêmes points que sf::CircleShape
+    const std::size_t count = shape.pointCount;
+    if (count < 3) return;
+
+    const float radius = shape.size.x / 2.f;
+    const sf::Vector2f center = { shape.position.x + radius, shape.position.y + radius };
+    // Décalage des sommets pour que chaque côté soit à t du bord d'origine
+    const float outerRadius = radius + t / std::cos(PI / static_cast<float>(count));
+
+    auto pointAt = [&](std::size_t i, float r) {
+        float angle = static_cast<float>(i) * 2.f * PI / static_cast<float>(count) - PI / 2.f;
+        return sf::Vector2f{ center.x + std::cos(angle) * r, center.y + std::sin(angle) * r };
+    };
+
+    for (std::size_t i = 0; i < count; i++) {
+        sf::Vector2f a = pointAt(i, radius);
+        sf::Vector2f b = pointAt((i + 1) % count, radius);
+
+        if (hasFill) {
+            appendTriangle(mesh, center, a, b, shape.fillColor);
+        }
+        if (hasOutline) {
+            appendQuad(mesh, a, b, pointAt((i + 1) % count, outerRadius), pointAt(i, outerRadius), shape.outlineColor);
+        }
+    }
+}
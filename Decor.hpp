@@ -0,0 +1,61 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "SpatialGrid.hpp"
+
+// Type de forme du décor
+enum class DecorKind : std::uint8_t { Rect, Circle };
+
+// Forme de décor compacte (POD, 32 octets).
+// Un sf::RectangleShape / sf::CircleShape garde sa transformation, ses sommets
+// et son contour en cache : plusieurs centaines d'octets par tuile. Ici on ne
+// garde que ce qu'il faut pour regénérer le maillage quand on en a besoin.
+struct DecorShape {
+    sf::Vector2f position;      // Coin haut-gauche (comme setPosition)
+    sf::Vector2f size;          // Taille du rectangle, ou diamètre du cercle
+    sf::Color fillColor;
+    sf::Color outlineColor;
+    float outlineThickness;
+    DecorKind kind;
+    std::uint8_t pointCount;    // Nombre de points du cercle (3 = triangle...)
+};
+
+// Couche de décor d'une zone : tableau contigu de DecorShape.
+// Les triangles ne sont générés qu'à la demande, au moment du rendu.
+class DecorLayer {
+public:
+    void clear() { shapes_.clear(); index_.clear(); }
+    void reserve(std::size_t count) { shapes_.reserve(count); }
+
+    // Conversion depuis les formes SFML (seules les infos utiles sont gardées)
+    void push_back(const sf::RectangleShape& shape);
+    void push_back(const sf::CircleShape& shape);
+
+    std::size_t size() const { return shapes_.size(); }
+    bool empty() const { return shapes_.empty(); }
+    const DecorShape& operator[](std::size_t i) const { return shapes_[i]; }
+    std::vector<DecorShape>::const_iterator begin() const { return shapes_.begin(); }
+    std::vector<DecorShape>::const_iterator end() const { return shapes_.end(); }
+
+    // Rectangle englobant de la forme (sans le contour), pour les collisions
+    static sf::FloatRect getBounds(const DecorShape& shape);
+    // Rectangle réellement dessiné (contour compris), pour le culling
+    static sf::FloatRect getDrawBounds(const DecorShape& shape);
+
+    // Index spatial des formes, à reconstruire après les ajouts
+    void buildIndex();
+    const SpatialGrid& getIndex() const { return index_; }
+
+    // Ajoute les triangles de toutes les formes à la fin de mesh
+    void appendMesh(sf::VertexArray& mesh) const;
+    // Ajoute seulement les formes qui touchent area (dans l'ordre de dessin), découpées
+    // aux bords de area : deux chunks voisins ne se recouvrent jamais et l'ordre de
+    // dessin reste correct. scratch sert de tampon de travail (réutilisé d'un appel à l'autre)
+    void appendClippedMesh(sf::VertexArray& mesh, const sf::FloatRect& area, std::vector<std::uint32_t>& visible, sf::VertexArray& scratch) const;
+    static void appendShape(sf::VertexArray& mesh, const DecorShape& shape);
+
+private:
+    std::vector<DecorShape> shapes_;
+    SpatialGrid index_;
+};
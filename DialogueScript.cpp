@@ -0,0 +1,189 @@
+#include "DialogueScript.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    std::string_view trim(std::string_view s) {
+        const char* spaces = " \t\r";
+        std::size_t first = s.find_first_not_of(spaces);
+        if (first == std::string_view::npos) return {};
+        std::size_t last = s.find_last_not_of(spaces);
+        return s.substr(first, last - first + 1);
+    }
+
+    // Sépare "texte -> cible" ; cible vide si la flèche manque
+    void splitArrow(std::string_view s, std::string_view& left, std::string_view& right) {
+        std::size_t arrow = s.rfind("->");
+        if (arrow == std::string_view::npos) {
+            left = trim(s);
+            right = {};
+            return;
+        }
+        left = trim(s.substr(0, arrow));
+        right = trim(s.substr(arrow + 2));
+    }
+
+    // Saut à résoudre une fois toutes les étiquettes connues
+    struct Fixup {
+        std::uint32_t word;
+        std::string label;
+        int line;
+        bool encoded;   // Cible dans l'opérande du mot (Jump) ou mot entier
+    };
+}
+
+bool DialogueScript::loadFromFile(const std::string& path, StringTable& strings) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Impossible de charger les dialogues : " << path << "\n";
+        clear();
+        return false;
+    }
+    std::ostringstream content;
+    content << file.rdbuf();
+    return compile(content.str(), path, strings);
+}
+
+void DialogueScript::clear() {
+    code_.clear();
+    strings_ = nullptr;
+    labels_.clear();
+    flags_.clear();
+}
+
+std::uint32_t DialogueScript::internFlag(std::string_view flag) {
+    auto it = flags_.try_emplace(std::string(flag), static_cast<std::uint32_t>(flags_.size())).first;
+    return it->second;
+}
+
+bool DialogueScript::compile(std::string_view source, const std::string& name, StringTable& strings) {
+    clear();
+    strings_ = &strings;
+
+    std::vector<Fixup> fixups;
+    bool ok = true;
+    bool inChoice = false;      // Une suite de "choice" forme un seul noeud
+    std::uint32_t choiceHeader = 0;
+    int lineNumber = 0;
+    std::string label;          // Étiquette en cours, pour les clés des textes
+    int textCount = 0;
+
+    auto error = [&](const std::string& message) {
+        std::cerr << name << ":" << lineNumber << " : " << message << "\n";
+        ok = false;
+    };
+
+    std::size_t pos = 0;
+    while (pos <= source.size()) {
+        std::size_t end = source.find('\n', pos);
+        if (end == std::string_view::npos) end = source.size();
+        std::string_view line = trim(source.substr(pos, end - pos));
+        pos = end + 1;
+        lineNumber++;
+
+        if (line.empty() || line[0] == '#') continue;
+
+        std::size_t space = line.find(' ');
+        std::string_view keyword = line.substr(0, space);
+        std::string_view arg = space == std::string_view::npos ? std::string_view() : trim(line.substr(space + 1));
+
+        if (keyword != "choice") inChoice = false;
+
+        // Clé stable du prochain texte de l'étiquette
+        auto addText = [&](std::string_view text) {
+            return strings.intern(label + "." + std::to_string(++textCount), text);
+        };
+
+        if (keyword[0] == '@') {
+            label = std::string(trim(keyword.substr(1)));
+            textCount = 0;
+            if (label.empty() || !labels_.emplace(label, static_cast<std::uint32_t>(code_.size())).second) {
+                error("etiquette vide ou deja definie : " + label);
+            }
+        }
+        else if (label.empty() && (keyword == "say" || keyword == "think" || keyword == "choice")) {
+            error("texte avant la premiere etiquette");
+        }
+        else if (keyword == "say" || keyword == "think") {
+            code_.push_back(encode(keyword == "say" ? DialogueOp::Say : DialogueOp::Think, addText(arg)));
+        }
+        else if (keyword == "choice") {
+            std::string_view text, target;
+            splitArrow(arg, text, target);
+            if (target.empty()) {
+                error("choix sans cible");
+                continue;
+            }
+            if (!inChoice) {
+                choiceHeader = static_cast<std::uint32_t>(code_.size());
+                code_.push_back(encode(DialogueOp::Choice, 0));
+                inChoice = true;
+            }
+            std::uint32_t count = getOperand(code_[choiceHeader]) + 1;
+            if (count > MAX_DIALOGUE_CHOICES) {
+                error("trop de choix dans un meme noeud");
+                continue;
+            }
+            code_[choiceHeader] = encode(DialogueOp::Choice, count);
+            code_.push_back(addText(text));
+            fixups.push_back({ static_cast<std::uint32_t>(code_.size()), std::string(target), lineNumber, false });
+            code_.push_back(0);
+        }
+        else if (keyword == "if" || keyword == "ifnot") {
+            std::string_view flag, target;
+            splitArrow(arg, flag, target);
+            if (flag.empty() || target.empty()) {
+                error("condition incomplete");
+                continue;
+            }
+            code_.push_back(encode(keyword == "if" ? DialogueOp::JumpIf : DialogueOp::JumpIfNot, internFlag(flag)));
+            fixups.push_back({ static_cast<std::uint32_t>(code_.size()), std::string(target), lineNumber, false });
+            code_.push_back(0);
+        }
+        else if (keyword == "goto") {
+            code_.push_back(encode(DialogueOp::Jump, 0));
+            fixups.push_back({ static_cast<std::uint32_t>(code_.size() - 1), std::string(arg), lineNumber, true });
+        }
+        else if (keyword == "set" || keyword == "unset") {
+            if (arg.empty()) {
+                error("flag manquant");
+                continue;
+            }
+            code_.push_back(encode(keyword == "set" ? DialogueOp::Set : DialogueOp::Clear, internFlag(arg)));
+        }
+        else if (keyword == "end") {
+            code_.push_back(encode(DialogueOp::End));
+        }
+        else {
+            error("instruction inconnue : " + std::string(keyword));
+        }
+    }
+    // Filet de sécurité : la dernière étiquette se termine toujours
+    code_.push_back(encode(DialogueOp::End));
+
+    // Résolution des sauts
+    for (const Fixup& fixup : fixups) {
+        auto it = labels_.find(fixup.label);
+        if (it == labels_.end()) {
+            lineNumber = fixup.line;
+            error("etiquette inconnue : " + fixup.label);
+            continue;
+        }
+        if (fixup.encoded) code_[fixup.word] = encode(getOp(code_[fixup.word]), it->second);
+        else code_[fixup.word] = it->second;
+    }
+
+    if (!ok) clear();
+    return ok;
+}
+
+std::uint32_t DialogueScript::getEntry(std::string_view label) const {
+    auto it = labels_.find(std::string(label));
+    return it != labels_.end() ? it->second : NO_ENTRY;
+}
+
+std::uint32_t DialogueScript::getFlag(std::string_view flag) const {
+    auto it = flags_.find(std::string(flag));
+    return it != flags_.end() ? it->second : NO_ENTRY;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "StringTable.hpp"
+
+// Instructions du bytecode. Un mot de 32 bits : l'opcode sur 8 bits,
+// l'opérande principal sur les 24 bits restants.
+//   Say texte                  réplique du NPC
+//   Think texte                pensée / narration (sans nom)
+//   Choice n, (texte, cible)*n choix proposés au joueur
+//   Jump cible
+//   JumpIf flag, cible         saute si le flag est levé
+//   JumpIfNot flag, cible
+//   Set flag / Clear flag
+//   End
+enum class DialogueOp : std::uint8_t { Say, Think, Choice, Jump, JumpIf, JumpIfNot, Set, Clear, End };
+
+// Nombre maximum de choix d'un même noeud (touches 1 à 4)
+const std::size_t MAX_DIALOGUE_CHOICES = 4;
+
+// Graphe de dialogues écrit dans un fichier texte (.dlg) et compilé en
+// bytecode au chargement. Les étiquettes (@nom) sont les points d'entrée
+// des NPCs ; les sauts sont résolus à la compilation, le VM n'a plus qu'à
+// suivre des indices. Les textes vont dans la StringTable sous la clé
+// "<etiquette>.<n>" (n-ième texte de l'étiquette) : le script donne le
+// texte de référence, les catalogues des autres langues le traduisent.
+//
+// Syntaxe, une instruction par ligne :
+//   # commentaire
+//   @etiquette
+//   say <texte>
+//   think <texte>
+//   choice <texte> -> <etiquette>    (les choix consécutifs forment un noeud)
+//   if <flag> -> <etiquette>
+//   ifnot <flag> -> <etiquette>
+//   set <flag>
+//   unset <flag>
+//   goto <etiquette>
+//   end
+class DialogueScript {
+public:
+    static const std::uint32_t NO_ENTRY = 0xFFFFFFFF;
+
+    // Les erreurs sont affichées (fichier:ligne) ; en cas d'erreur le script reste vide
+    bool loadFromFile(const std::string& path, StringTable& strings);
+    bool compile(std::string_view source, const std::string& name, StringTable& strings);
+    void clear();
+
+    // Position de l'étiquette dans le bytecode, ou NO_ENTRY
+    std::uint32_t getEntry(std::string_view label) const;
+    // Identifiant du flag, ou NO_ENTRY s'il n'apparaît dans aucun script
+    std::uint32_t getFlag(std::string_view flag) const;
+    std::size_t getFlagCount() const { return flags_.size(); }
+    // Nom -> identifiant de tous les flags
+    const std::unordered_map<std::string, std::uint32_t>& getFlags() const { return flags_; }
+    // Table où lire les textes (après avoir déplacé la table et le script)
+    void setStrings(const StringTable* strings) { strings_ = strings; }
+
+    const std::vector<std::uint32_t>& getCode() const { return code_; }
+    std::string_view getText(StringId id) const { return strings_ ? strings_->get(id) : std::string_view(); }
+
+    static std::uint32_t encode(DialogueOp op, std::uint32_t operand = 0) { return static_cast<std::uint32_t>(op) | (operand << 8); }
+    static DialogueOp getOp(std::uint32_t word) { return static_cast<DialogueOp>(word & 0xFF); }
+    static std::uint32_t getOperand(std::uint32_t word) { return word >> 8; }
+
+private:
+    std::uint32_t internFlag(std::string_view flag);
+
+    std::vector<std::uint32_t> code_;
+    const StringTable* strings_ = nullptr;
+    std::unordered_map<std::string, std::uint32_t> labels_;
+    std::unordered_map<std::string, std::uint32_t> flags_;
+};
@@ -0,0 +1,40 @@
+#include "DialogueStore.hpp"
+
+DialogueStore::DialogueStore()
+    : offsets_(1, 0)
+{
+}
+
+void DialogueStore::clear() {
+    text_.clear();
+    offsets_.assign(1, 0);
+}
+
+void DialogueStore::reserve(std::size_t lines, std::size_t bytes) {
+    offsets_.reserve(lines + 1);
+    text_.reserve(bytes);
+}
+
+void DialogueStore::append(std::string_view line) {
+    text_.append(line);
+    offsets_.push_back(static_cast<std::uint32_t>(text_.size()));
+}
+
+DialogueRange DialogueStore::add(std::initializer_list<std::string_view> lines) {
+    DialogueRange range{ static_cast<std::uint32_t>(getLineCount()), static_cast<std::uint32_t>(lines.size()) };
+    for (std::string_view line : lines) {
+        append(line);
+    }
+    return range;
+}
+
+std::uint32_t DialogueStore::add(std::string_view line) {
+    std::uint32_t index = static_cast<std::uint32_t>(getLineCount());
+    append(line);
+    return index;
+}
+
+std::string_view DialogueStore::getLine(std::uint32_t index) const {
+    if (index >= getLineCount()) return {};
+    return std::string_view(text_).substr(offsets_[index], offsets_[index + 1] - offsets_[index]);
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Suite de répliques consécutives dans le DialogueStore
+struct DialogueRange {
+    std::uint32_t first = 0;
+    std::uint32_t count = 0;
+};
+
+// Toutes les répliques du jeu rangées bout à bout dans un seul buffer.
+// Les NPCs ne gardent qu'un DialogueRange ; les accès renvoient des
+// string_view sur le buffer, sans copie. Un string_view obtenu reste
+// valable jusqu'au prochain add() ou clear().
+class DialogueStore {
+public:
+    DialogueStore();
+
+    void clear();
+    void reserve(std::size_t lines, std::size_t bytes);
+
+    // Ajoute des répliques à la suite et renvoie leur plage
+    DialogueRange add(std::initializer_list<std::string_view> lines);
+    // Ajoute une réplique et renvoie son indice
+    std::uint32_t add(std::string_view line);
+
+    std::string_view getLine(std::uint32_t index) const;
+    std::string_view getLine(const DialogueRange& range, std::uint32_t i) const { return getLine(range.first + i); }
+
+    std::size_t getLineCount() const { return offsets_.size() - 1; }
+    std::size_t getByteCount() const { return text_.size(); }
+
+private:
+    void append(std::string_view line);
+
+    std::string text_;                   // Toutes les répliques, sans séparateur
+    std::vector<std::uint32_t> offsets_; // Début de chaque réplique, + la fin du buffer
+};
@@ -0,0 +1,154 @@
+#include "DialogueVM.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // Au-delà, on considère que le script boucle sans rien afficher
+    const int MAX_INSTRUCTIONS = 4096;
+
+    // Mots qui suivent l'instruction, -1 si elle est invalide (code abîmé,
+    // ou position qui ne tombe pas au début d'une instruction)
+    long getOperandWords(DialogueOp op, std::uint32_t operand) {
+        switch (op) {
+        case DialogueOp::Choice:
+            if (operand == 0 || operand > MAX_DIALOGUE_CHOICES) return -1;
+            return static_cast<long>(operand) * 2;
+        case DialogueOp::JumpIf:
+        case DialogueOp::JumpIfNot:
+            return 1;
+        case DialogueOp::Say:
+        case DialogueOp::Think:
+        case DialogueOp::Jump:
+        case DialogueOp::Set:
+        case DialogueOp::Clear:
+        case DialogueOp::End:
+            return 0;
+        }
+        return -1;
+    }
+}
+
+DialogueVM::DialogueVM()
+    : script_(nullptr)
+    , pc_(0)
+    , step_(DialogueStep::Finished)
+{
+}
+
+void DialogueVM::setScript(const DialogueScript* script) {
+    script_ = script;
+    step_ = DialogueStep::Finished;
+    resetFlags();
+}
+
+void DialogueVM::resetFlags() {
+    flags_.assign(script_ ? script_->getFlagCount() : 0, false);
+}
+
+void DialogueVM::setFlag(std::uint32_t flag, bool value) {
+    if (flag >= flags_.size()) flags_.resize(flag + 1, false);
+    flags_[flag] = value;
+}
+
+void DialogueVM::start(std::uint32_t entry) {
+    step_ = DialogueStep::Finished;
+    if (!script_ || entry >= script_->getCode().size()) return;
+    pc_ = entry;
+    run();
+}
+
+void DialogueVM::advance() {
+    if (step_ != DialogueStep::Line && step_ != DialogueStep::Thought) return;
+    pc_++;
+    run();
+}
+
+void DialogueVM::choose(std::size_t i) {
+    if (step_ != DialogueStep::Choice || i >= getChoiceCount()) return;
+    pc_ = script_->getCode()[pc_ + 2 + i * 2];
+    run();
+}
+
+std::string_view DialogueVM::getText() const {
+    if (step_ != DialogueStep::Line && step_ != DialogueStep::Thought) return {};
+    return script_->getText(DialogueScript::getOperand(script_->getCode()[pc_]));
+}
+
+std::size_t DialogueVM::getChoiceCount() const {
+    if (step_ != DialogueStep::Choice) return 0;
+    // run() a vérifié le noeud ; la borne protège encore les tableaux des appelants
+    return std::min<std::size_t>(DialogueScript::getOperand(script_->getCode()[pc_]), MAX_DIALOGUE_CHOICES);
+}
+
+std::string_view DialogueVM::getChoice(std::size_t i) const {
+    if (i >= getChoiceCount()) return {};
+    return script_->getText(script_->getCode()[pc_ + 1 + i * 2]);
+}
+
+bool DialogueVM::isNode(std::uint32_t position) const {
+    if (!script_) return false;
+    const std::vector<std::uint32_t>& code = script_->getCode();
+
+    std::size_t pc = 0;
+    while (pc < position && pc < code.size()) {
+        const long operandWords = getOperandWords(DialogueScript::getOp(code[pc]), DialogueScript::getOperand(code[pc]));
+        if (operandWords < 0) return false;
+        pc += 1 + static_cast<std::size_t>(operandWords);
+    }
+    if (pc != position || pc >= code.size()) return false;
+
+    const DialogueOp op = DialogueScript::getOp(code[pc]);
+    const long operandWords = getOperandWords(op, DialogueScript::getOperand(code[pc]));
+    return (op == DialogueOp::Say || op == DialogueOp::Think || op == DialogueOp::Choice)
+        && operandWords >= 0 && pc + static_cast<std::size_t>(operandWords) < code.size();
+}
+
+void DialogueVM::run() {
+    const std::vector<std::uint32_t>& code = script_->getCode();
+
+    for (int count = 0; count < MAX_INSTRUCTIONS && pc_ < code.size(); count++) {
+        std::uint32_t word = code[pc_];
+        std::uint32_t operand = DialogueScript::getOperand(word);
+
+        // Opérandes lus avant de décoder : jamais au-delà de la fin du code
+        const long operandWords = getOperandWords(DialogueScript::getOp(word), operand);
+        if (operandWords < 0 || pc_ + static_cast<std::size_t>(operandWords) >= code.size()) {
+            std::cerr << "Dialogue interrompu : instruction invalide à la position " << pc_ << "\n";
+            step_ = DialogueStep::Finished;
+            return;
+        }
+
+        switch (DialogueScript::getOp(word)) {
+        case DialogueOp::Say:
+            step_ = DialogueStep::Line;
+            return;
+        case DialogueOp::Think:
+            step_ = DialogueStep::Thought;
+            return;
+        case DialogueOp::Choice:
+            step_ = DialogueStep::Choice;
+            return;
+        case DialogueOp::Jump:
+            pc_ = operand;
+            break;
+        case DialogueOp::JumpIf:
+            pc_ = getFlag(operand) ? code[pc_ + 1] : pc_ + 2;
+            break;
+        case DialogueOp::JumpIfNot:
+            pc_ = getFlag(operand) ? pc_ + 2 : code[pc_ + 1];
+            break;
+        case DialogueOp::Set:
+        case DialogueOp::Clear:
+            if (operand >= flags_.size()) flags_.resize(operand + 1, false);
+            flags_[operand] = DialogueScript::getOp(word) == DialogueOp::Set;
+            pc_++;
+            break;
+        case DialogueOp::End:
+            step_ = DialogueStep::Finished;
+            return;
+        }
+    }
+
+    if (pc_ < code.size()) std::cerr << "Dialogue interrompu : boucle sans texte\n";
+    step_ = DialogueStep::Finished;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "DialogueScript.hpp"
+
+// Ce que le dialogue attend du joueur
+enum class DialogueStep { Line, Thought, Choice, Finished };
+
+// Exécute le bytecode d'un DialogueScript : avance jusqu'au prochain noeud
+// à afficher (réplique, pensée ou choix) et s'y arrête. Chaque instruction
+// coûte un temps constant. Les flags sont partagés par tous les dialogues
+// et restent levés d'une conversation à l'autre.
+class DialogueVM {
+public:
+    DialogueVM();
+
+    void setScript(const DialogueScript* script);
+    void resetFlags();
+
+    void start(std::uint32_t entry);
+    // Passe la réplique ou la pensée affichée
+    void advance();
+    // Suit le choix i du noeud affiché
+    void choose(std::size_t i);
+
+    DialogueStep getStep() const { return step_; }
+    // Texte de la réplique ou de la pensée affichée
+    std::string_view getText() const;
+    std::size_t getChoiceCount() const;
+    std::string_view getChoice(std::size_t i) const;
+
+    bool getFlag(std::uint32_t flag) const { return flag < flags_.size() && flags_[flag]; }
+    std::size_t getFlagCount() const { return flags_.size(); }
+    void setFlag(std::uint32_t flag, bool value);
+
+    // Noeud affiché : start() avec cette position reprend la conversation au même endroit
+    std::uint32_t getPosition() const { return pc_; }
+    // Vrai si position est le début d'une instruction Say, Think ou Choice du
+    // script (une position sauvegardée avant une modification du script peut
+    // tomber au milieu d'une instruction). Parcourt le code depuis le début.
+    bool isNode(std::uint32_t position) const;
+
+private:
+    // Exécute les instructions jusqu'au prochain noeud à afficher
+    void run();
+
+    const DialogueScript* script_;
+    std::uint32_t pc_;      // Instruction affichée (Say, Think ou Choice)
+    DialogueStep step_;
+    std::vector<bool> flags_;
+};
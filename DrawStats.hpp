@@ -0,0 +1,23 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <utility>
+
+// Appels de dessin de la frame. SFML ne les compte pas : le jeu dessine
+// avec DrawStats::draw(target, ...) au lieu de target.draw(...).
+// Remis à zéro par celui qui mesure (tests de performance). Une forme ou
+// un texte avec contour compte pour un appel (deux pour OpenGL).
+class DrawStats {
+public:
+    template <typename... Args>
+    static void draw(sf::RenderTarget& target, Args&&... args) {
+        calls_++;
+        target.draw(std::forward<Args>(args)...);
+    }
+
+    static std::uint32_t getCalls() { return calls_; }
+    static void reset() { calls_ = 0; }
+
+private:
+    static inline std::uint32_t calls_ = 0; // Thread principal seulement
+};
@@ -0,0 +1,79 @@
+#include "FlowField.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace {
+    // Mêmes coûts et mêmes voisins que le PathService
+    const std::uint32_t STRAIGHT_COST = 10;
+    const std::uint32_t DIAGONAL_COST = 14;
+
+    const int DX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+    const int DY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+}
+
+void FlowField::build(const NavGrid& grid, const std::vector<sf::Vector2f>& goals) {
+    grid_ = &grid;
+    const std::size_t cellCount = grid.getCellCount();
+    const int width = grid.getWidth();
+    cost_.assign(cellCount, UNREACHABLE);
+    dirX_.assign(cellCount, 0.f);
+    dirY_.assign(cellCount, 0.f);
+
+    // Tous les objectifs partent ensemble avec un coût nul
+    std::vector<OpenNode> open;
+    for (sf::Vector2f goal : goals) {
+        const std::uint32_t cell = grid.findNearestWalkable(goal);
+        if (cell == NavGrid::NO_CELL || cost_[cell] == 0) continue;
+        cost_[cell] = 0;
+        open.push_back({ 0, cell });
+    }
+    std::make_heap(open.begin(), open.end(), std::greater<OpenNode>());
+
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), std::greater<OpenNode>());
+        const OpenNode node = open.back();
+        open.pop_back();
+        if (node.cost > cost_[node.cell]) continue; // Entrée périmée
+
+        const int x = static_cast<int>(node.cell) % width;
+        const int y = static_cast<int>(node.cell) / width;
+        for (int i = 0; i < 8; i++) {
+            const int nx = x + DX[i];
+            const int ny = y + DY[i];
+            if (!grid.isWalkable(nx, ny)) continue;
+            if (i >= 4 && (!grid.isWalkable(nx, y) || !grid.isWalkable(x, ny))) continue;
+
+            const auto next = static_cast<std::uint32_t>(ny * width + nx);
+            const std::uint32_t cost = node.cost + (i >= 4 ? DIAGONAL_COST : STRAIGHT_COST);
+            if (cost >= cost_[next]) continue;
+            cost_[next] = cost;
+            open.push_back({ cost, next });
+            std::push_heap(open.begin(), open.end(), std::greater<OpenNode>());
+        }
+    }
+
+    // Direction de chaque case : vers le voisin de plus petit coût
+    for (std::size_t cell = 0; cell < cellCount; cell++) {
+        if (cost_[cell] == 0 || cost_[cell] == UNREACHABLE) continue;
+        const int x = static_cast<int>(cell) % width;
+        const int y = static_cast<int>(cell) / width;
+        std::uint32_t best = cost_[cell];
+        int bestDir = -1;
+        for (int i = 0; i < 8; i++) {
+            const int nx = x + DX[i];
+            const int ny = y + DY[i];
+            if (!grid.isWalkable(nx, ny)) continue;
+            if (i >= 4 && (!grid.isWalkable(nx, y) || !grid.isWalkable(x, ny))) continue;
+            const std::uint32_t cost = cost_[static_cast<std::size_t>(ny * width + nx)];
+            if (cost < best) {
+                best = cost;
+                bestDir = i;
+            }
+        }
+        if (bestDir < 0) continue;
+        const float length = bestDir >= 4 ? std::sqrt(2.f) : 1.f;
+        dirX_[cell] = static_cast<float>(DX[bestDir]) / length;
+        dirY_[cell] = static_cast<float>(DY[bestDir]) / length;
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <vector>
+#include "NavGrid.hpp"
+
+// Champ de directions vers les objectifs les plus proches, calculé une fois
+// pour toute une grille (Dijkstra depuis tous les objectifs à la fois).
+// Contrairement au PathService, le coût ne dépend pas du nombre d'agents :
+// chacun lit simplement la direction de la case où il se trouve.
+class FlowField {
+public:
+    static constexpr std::uint32_t UNREACHABLE = 0xFFFFFFFFu;
+
+    // La grille doit rester en vie tant que le champ est utilisé
+    void build(const NavGrid& grid, const std::vector<sf::Vector2f>& goals);
+
+    const NavGrid* getGrid() const { return grid_; }
+    // Distance (10 par case droite, 14 en diagonale) jusqu'à l'objectif le
+    // plus proche : 0 sur un objectif, UNREACHABLE hors d'atteinte
+    std::uint32_t getCost(std::uint32_t cell) const { return cell < cost_.size() ? cost_[cell] : UNREACHABLE; }
+    // Direction unitaire vers la case voisine la plus proche des objectifs
+    // (nulle sur un objectif ou hors d'atteinte)
+    sf::Vector2f getDirection(std::uint32_t cell) const {
+        return cell < dirX_.size() ? sf::Vector2f(dirX_[cell], dirY_[cell]) : sf::Vector2f(0.f, 0.f);
+    }
+
+private:
+    struct OpenNode {
+        std::uint32_t cost;
+        std::uint32_t cell;
+        bool operator>(const OpenNode& other) const { return cost > other.cost; }
+    };
+
+    const NavGrid* grid_ = nullptr;
+    std::vector<std::uint32_t> cost_;
+    std::vector<float> dirX_;
+    std::vector<float> dirY_;
+};
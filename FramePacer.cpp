@@ -0,0 +1,62 @@
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace {
+    using namespace std::chrono;
+
+    // Marge d'attente active : au moins 0,5 ms, au plus 4 ms
+    const microseconds MIN_SPIN(500);
+    const microseconds MAX_SPIN(4000);
+}
+
+FramePacer::FramePacer(sf::Window& window)
+    : window_(window)
+    , policy_(PacingPolicy::TargetFps)
+    , period_(0)
+    , deadline_(Clock::now())
+    , sleepError_(MIN_SPIN)
+{
+}
+
+void FramePacer::setPolicy(PacingPolicy policy, unsigned targetFps) {
+    policy_ = policy;
+    period_ = duration_cast<Clock::duration>(duration<double>(1.0 / std::max(targetFps, 1u)));
+    deadline_ = Clock::now() + period_;
+
+    // Une seule limite à la fois : SFML ne doit pas dormir en plus
+    window_.setFramerateLimit(0);
+    window_.setVerticalSyncEnabled(policy == PacingPolicy::VSync);
+}
+
+void FramePacer::endFrame() {
+    if (policy_ != PacingPolicy::TargetFps) return;
+
+    Clock::time_point now = Clock::now();
+    // Trop en retard (chargement, fenêtre déplacée) : on repart de maintenant
+    // plutôt que d'enchaîner des frames pour rattraper
+    if (now >= deadline_ + period_) {
+        deadline_ = now + period_;
+        return;
+    }
+
+    const Clock::duration margin = std::clamp<Clock::duration>(sleepError_ * 2, MIN_SPIN, MAX_SPIN);
+    if (deadline_ - now > margin) {
+        const Clock::duration request = deadline_ - now - margin;
+        sf::sleep(sf::microseconds(static_cast<std::int64_t>(duration_cast<microseconds>(request).count())));
+
+        // Le dépassement mesuré décroît lentement s'il ne se reproduit pas
+        const Clock::duration overshoot = Clock::now() - now - request;
+        sleepError_ = std::max(overshoot, sleepError_ - sleepError_ / 16);
+    }
+    while (Clock::now() < deadline_) {
+        std::this_thread::yield();
+    }
+    deadline_ += period_;
+}
+
+std::optional<sf::Event> FramePacer::waitForEvent(sf::Time timeout) {
+    std::optional<sf::Event> event = window_.waitEvent(timeout);
+    deadline_ = Clock::now() + period_;
+    return event;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <SFML/Window.hpp>
+#include <chrono>
+#include <optional>
+
+// Cadence des frames
+enum class PacingPolicy {
+    VSync,      // Synchronisation verticale (le pilote attend l'écran)
+    TargetFps   // Fréquence fixe : sommeil puis attente active pour la fin
+};
+
+// Limite la boucle de jeu au lieu de la laisser tourner à fond.
+// En TargetFps, on dort jusqu'à un peu avant l'échéance de la frame, puis
+// on attend activement les dernières centaines de microsecondes : le sommeil
+// du système dépasse souvent d'une milliseconde ou plus, la marge s'adapte
+// à ce dépassement mesuré.
+// Sur un écran immobile (menu, pause), waitForEvent() bloque jusqu'au
+// prochain événement : le processus ne consomme alors plus rien.
+class FramePacer {
+public:
+    explicit FramePacer(sf::Window& window);
+
+    void setPolicy(PacingPolicy policy, unsigned targetFps = 60);
+    PacingPolicy getPolicy() const { return policy_; }
+
+    // Attend la fin de la frame courante (rien en VSync : display() attend)
+    void endFrame();
+
+    // Bloque jusqu'au prochain événement (écran immobile), ou au plus timeout
+    // s'il n'est pas nul ; la frame suivante repart de zéro, le temps passé
+    // à attendre ne compte pas
+    std::optional<sf::Event> waitForEvent(sf::Time timeout = sf::Time::Zero);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    sf::Window& window_;
+    PacingPolicy policy_;
+    Clock::duration period_;
+    Clock::time_point deadline_;
+    Clock::duration sleepError_;    // Plus grand dépassement récent du sommeil
+};
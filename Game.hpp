@@ -6,73 +6,157 @@
 #include <iostream>
 #include <algorithm>
 #include <memory>
-#include <variant>
-#include "IEntity.hpp"
+#include <unordered_map>
+#include "World.hpp"
 #include "NPC.hpp"
 #include "HUD.hpp"
+#include "Decor.hpp"
+#include "SpatialGrid.hpp"
+#include "ChunkStreamer.hpp"
+#include "TriggerSystem.hpp"
+#include "DialogueScript.hpp"
+#include "DialogueVM.hpp"
+#include "StringTable.hpp"
+#include "TextLayout.hpp"
+#include "Transition.hpp"
+#include "SaveFile.hpp"
+#include "StateHistory.hpp"
+#include "InputMap.hpp"
+#include "StateStack.hpp"
+#include "FramePacer.hpp"
+#include "AgentSystem.hpp"
+#include "Crowd.hpp"
+#include "ParticleSystem.hpp"
+#include "AudioEngine.hpp"
+#include "AreaFile.hpp"
+#include "HotReload.hpp"
+#include "InputSession.hpp"
+#include "DebugOverlay.hpp"
 
-enum class GameState { Menu, Playing, Paused, Credits };
-enum class Direction { Right, Left, Up, Down };
-
-class Player : public IEntity {
-public:
-    Player(sf::Vector2f size, float speed);
-    void update(sf::Time dt) override;
-    void draw(sf::RenderWindow& window) override;
-    sf::FloatRect getGlobalBounds() const override;
-    void setPosition(sf::Vector2f pos) override;
-    sf::Vector2f getPosition() const override;
-    Direction getDirection() const { return direction_; }
-private:
-    sf::RectangleShape shape_;
-    float speed_;
-    Direction direction_;
+// Description d'une zone du monde (elle peut tre plus grande que l'cran)
+struct AreaInfo {
+    sf::Vector2f size;
+    sf::Color background;
+    const DecorLayer* decor;
+    bool solid; // Le dcor bloque le joueur (meubles de la maison)
+    StringId name;
+    std::vector<ParticleSystem::EmitterId> emitters; // Effets d'ambiance (voir setupParticles)
+    std::string music;  // Lue en flux, "" : silence
 };
 
-struct TriggerZone {
-    sf::FloatRect bounds;
-    std::string currentArea;
-    std::string targetArea;
-    bool used = false;
-};
-
-// Type pour stocker diffrents types de formes
-using DecorShape = std::variant<sf::RectangleShape, sf::CircleShape>;
-
 class Game {
 public:
-    Game();
+    // headless : sans fentre, ni son, ni rechargement des fichiers, avec sa
+    // propre sauvegarde ; le jeu n'avance que par simulateFrame().
+    // savePath : fichier de sauvegarde ("" : celui par dfaut, dans le dossier courant)
+    explicit Game(bool headless = false, const std::string& savePath = "");
     void run();
+    // Vsync, ou frquence fixe (60 images/s par dfaut)
+    void setFramePacing(PacingPolicy policy, unsigned targetFps = 60);
+
+    // Enregistre les entres de chaque frame de run(), crites dans path 
+    // la fermeture de la fentre (voir InputSession)
+    void recordSession(const std::string& path);
+    // Rejoue une frame enregistre : entres, actions puis mise  jour, sans rendu
+    void simulateFrame(const SessionFrame& frame);
+    // Dessine la frame dans une texture (headless, mesures de performance)
+    void renderTo(sf::RenderTexture& target);
+    // Cre les textures de l'image fige et des transitions. Appele par le
+    // jeu avec sa fentre ; sans fentre, seulement avant renderTo
+    void setRenderSize(sf::Vector2u size);
+
+    // tat observ par les parties scriptes (tests/)
+    const std::string& getCurrentArea() const { return currentArea_; }
+    GameState getState() const { return states_.getCurrent(); }
+    sf::Vector2f getPlayerPosition() const { return world_.getPosition(player_); }
+    bool isDialogueShown() const { return hud_->isDialogueShown(); }
 private:
-    void processEvents();
+    friend class MenuState;
+    friend class PlayingState;
+    friend class PausedState;
+    friend class CreditsState;
+
+    struct AreaNPCs;
+
+    // first : vnement qui a rveill la boucle (cran immobile)
+    void processEvents(const std::optional<sf::Event>& first);
+    void handleEvent(const sf::Event& event);
+    // Rien ne bouge  l'cran sans vnement : inutile de redessiner
+    bool isIdle() const;
+    // Actions de la frame (clavier, manette ou entres injectes)
+    void handleActions();
+    void handleDialogueActions();
     void update(sf::Time dt);
     void render();
+    // Mise  jour et rendu de chaque cran (appels par GameStates.cpp)
+    void updatePlaying(sf::Time dt);
+    // Renvoie vrai quand le gnrique est termin
+    bool updateCredits(sf::Time dt);
+    void renderMenu(sf::RenderTarget& target);
+    void renderWorld(sf::RenderTarget& target);
+    void renderPauseMenu(sf::RenderTarget& target);
+    void renderCredits(sf::RenderTarget& target);
+    void setupLocalization();
+    void setLocale(Locale locale);
+    void toggleLocale();
+    // Remet les textes des menus et des crdits dans la langue courante
+    void refreshTexts();
     void setupMenu();
     void resetGame();
+    // Tout l'tat de la partie, pour la sauvegarde
+    void captureState(GameSnapshot& snapshot) const;
+    void applyState(const GameSnapshot& snapshot);
+    void saveGame();
+    void loadGame();
+    // Retour en arrire (dbogage) : frame index de l'historique
+    void showHistoryFrame(std::size_t index);
     void setupPauseMenu();
     void setupTriggers();
-    void setupFurniture();
-    void setupStreetDecor();
-    void setupManifDecor();
-    void setupGareDecor();
-    void setupTrainDecor();
-    void setupSchoolDecor();
+    // Triggers des sorties et indications lues dans les fichiers de zone
+    void buildTriggers();
     void setupCredits();
     void setupNPCs();
+    // Cre les NPCs et les files d'attente d'une zone (ceux qu'elle avait sont retirs)
+    void spawnAreaNPCs(const std::string& area, const AreaData& data);
+    std::uint32_t getDialogueEntry(const std::string& label) const;
+    void setupAreas();
+    void setupCrowd();
+    void setupParticles();
+    void setupRain();
+    void setupAudio();
+    // Met en place les fichiers de donnes modifis pendant le jeu (entre deux frames)
+    void applyReloads();
+    void applyArea(const std::string& area, std::unique_ptr<AreaData> data);
+    void applyTexts(Reloaded& reloaded);
+    void enterArea(const std::string& area);
+    void showDialogueStep();
     bool checkCollision(const sf::FloatRect& playerBounds, const sf::FloatRect& zoneBounds);
-    sf::Vector2f calculateSpawnPosition(const std::string& newArea);
+    // Point d'arrive d'une sortie ; faux (erreur affiche) si la sortie ne mne nulle part
+    bool findSpawn(const std::string& area, const ExitDef& exit, sf::Vector2f& spawn) const;
     void checkFurnitureCollision();
     void checkNPCInteractions();
+    void buildNPCIndex();
+    // Index d'une zone,  refaire quand ses NPCs se dplacent
+    void buildAreaIndex(AreaNPCs& entry);
+    void updateCamera();
+    sf::FloatRect getCameraRect() const;
+    // Centre de la camra qui suit focus dans une zone de taille areaSize
+    sf::Vector2f getCameraCenter(sf::Vector2f areaSize, sf::Vector2f focus) const;
 
-    sf::RenderWindow window_;
-    GameState state_;
+    bool headless_;
+    sf::RenderWindow window_;   // Pas cre en headless
+    StateStack states_;         // cran affich au sommet (menu, partie, pause, crdits)
     sf::Clock clock_;
+    FramePacer pacer_;
+    InputMap input_;
 
     // Menu
     sf::Font font_;
+    StringTable strings_;       // Textes traduits (menus, HUD, dialogues)
     std::optional<sf::Text> titleText_;
     sf::RectangleShape playButtonRect_;
     std::optional<sf::Text> playButtonText_;
+    std::optional<sf::Text> languageText_;
 
     // Menu Pause
     sf::RectangleShape pauseOverlay_;
@@ -82,28 +166,68 @@ private:
     std::optional<sf::Text> resumeButtonText_;
     std::optional<sf::Text> quitButtonText_;
 
-    // Player
-    std::unique_ptr<Player> player_;
+    // Entits (joueur et NPCs) et leurs composants
+    World world_;
+    Entity player_;
+    std::vector<Entity> drawList_; // Entits visibles (rutilis chaque frame)
 
     // NPCs
-    std::vector<std::unique_ptr<NPC>> npcs_;
-    NPC* currentNPCInRange_;
+    DialogueScript dialogues_;  // Script compil de tous les NPCs
+    DialogueVM dialogue_;       // Conversation en cours
+    Entity currentNPCInRange_;
+    Entity dialogueNPC_;        // NPC de la conversation en cours
+    std::uint32_t endFlag_;     // Flag "fin_du_jeu" du script
+    StringId speakerNames_[SPEAKER_COUNT];
+
+    // NPCs rangs par zone, avec un index spatial pour le culling et les interactions.
+    // byChunk : seuls les NPCs des chunks chargs sont anims et dplacs
+    struct AreaNPCs {
+        std::vector<Entity> npcs;
+        std::vector<std::string> labels;    // tiquette du dialogue de chaque NPC
+        SpatialGrid index;
+        std::unordered_map<std::uint64_t, std::vector<Entity>> byChunk;
+    };
+    std::unordered_map<std::string, AreaNPCs> areaNPCs_;
+    std::vector<std::uint32_t> visible_; // Rsultat des requtes (rutilis chaque frame)
+    std::vector<Entity> movingNPCs_;     // NPCs des chunks chargs (rutilis chaque frame)
+    std::vector<sf::FloatRect> npcBounds_; // Tampon de buildAreaIndex
+
+    // Dplacement des NPCs : une grille de navigation par zone (AreaData),
+    // chemins calculs dans un budget fixe par frame
+    PathService paths_;
+    AgentSystem agents_;
+    std::unordered_map<std::string, std::uint32_t> queueIds_; // "zone/file" -> file de l'AgentSystem
+
+    // Foule de la manifestation (rue_manif), qui s'carte devant le joueur
+    Crowd crowd_;
+    std::vector<CrowdRepeller> crowdRepellers_;
+
+    // Pluie, vapeur, confettis : les metteurs sont rangs dans la zone (AreaInfo)
+    ParticleSystem particles_;
+    ParticleSystem::EmitterId rainId_;  // Suit la largeur de la rue
+
+    // Musique de la zone et bruitages (chargs et ouverts en fond)
+    AudioEngine audio_;
+    std::size_t blipGlyphs_;    // Glyphes rvls depuis le dernier bip
+
+    // Camra qui suit le joueur dans la zone
+    sf::View camera_;
 
     // HUD
     std::unique_ptr<HUD> hud_;
 
     // Zones trigger
-    std::vector<TriggerZone> triggers_;
+    TriggerSystem triggers_;
     std::string currentArea_;
     std::string nextArea_;
     sf::Vector2f nextSpawnPos_;
     bool gameFinished_;
 
-    // Fade transition
-    bool fading_;
-    bool fadeIn_;
-    float fadeAlpha_;
-    float fadeSpeed_;
+    // Transition entre zones (la zone d'arrive est prcharge pendant la sortie)
+    Transition transition_;
+
+    // Panneau de dbogage (F3) : frame, dessins, allocations
+    DebugOverlay debugOverlay_;
 
     // Portes et chemins (rectangles visibles)
     sf::RectangleShape doorRect_;
@@ -114,19 +238,41 @@ private:
     sf::RectangleShape trainDoorRect_;
     sf::RectangleShape trainExitDoorRect_;
 
-    // Meubles maison
-    std::vector<sf::RectangleShape> furniture_;
+    // Dcor, grille et NPCs de chaque zone, lus dans assets/areas (voir AreaFile.hpp)
+    std::unordered_map<std::string, std::unique_ptr<AreaData>> areaData_;
+
+    // Fichiers de donnes relus pendant le jeu. La zone courante attend que
+    // ses nouveaux chunks soient prts (staged_) pour changer d'un coup
+    HotReload reload_;
+    std::vector<Reloaded> reloads_;
+    std::unordered_map<std::string, std::unique_ptr<AreaData>> staged_;
 
-    // Dcors de la rue (avec variant pour supporter RectangleShape et CircleShape)
-    std::vector<DecorShape> streetDecor_;
-    std::vector<DecorShape> manifDecor_;
-    std::vector<DecorShape> gareDecor_;  
-    std::vector<DecorShape> trainDecor_;  
-    std::vector<DecorShape> schoolDecor_;  
+    // Zones du monde, et chunks de la zone courante chargs autour de la camra
+    // (dclar aprs les dcors : le thread de fond s'arrte avant leur destruction)
+    std::unordered_map<std::string, AreaInfo> areas_;
+    ChunkStreamer streamer_;
+    std::vector<sf::FloatRect> colliders_; // Rsultat des requtes (rutilis chaque frame)
 
     // Crdits du jeu
     bool creditsStarted_;
     float creditsScroll_;
     float creditsSpeed_;
-    std::vector<sf::Text> creditsTexts_;
+    std::vector<StringId> creditsLines_;
+    // Mis en page une fois (une page par ligne), dfile avec une seule translation
+    TextLayout creditsLayout_;
+
+    // Sauvegarde (crite en fond, automatique  chaque changement de zone)
+    SaveFile saveFile_;
+    GameSnapshot snapshot_;
+
+    // Historique des dernires secondes de jeu (F6 : retour en arrire)
+    StateHistory history_;
+    std::vector<std::uint8_t> historyState_;
+    bool rewinding_;
+    std::size_t rewindIndex_;
+
+    // Session en cours d'enregistrement (sessionPath_ vide : aucune)
+    std::string sessionPath_;
+    InputSession session_;
+    std::optional<sf::Vector2f> sessionClick_;
 };
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "GameSnapshot.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    // Lecture/écriture petit-boutiste, indépendante de la plateforme
+    void writeU8(std::vector<std::uint8_t>& out, std::uint8_t value) {
+        out.push_back(value);
+    }
+
+    void writeU16(std::vector<std::uint8_t>& out, std::uint16_t value) {
+        out.push_back(static_cast<std::uint8_t>(value));
+        out.push_back(static_cast<std::uint8_t>(value >> 8));
+    }
+
+    void writeU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            out.push_back(static_cast<std::uint8_t>(value >> shift));
+        }
+    }
+
+    void writeF32(std::vector<std::uint8_t>& out, float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeU32(out, bits);
+    }
+
+    // Longueur (255 au plus), puis les caractères
+    void writeString(std::vector<std::uint8_t>& out, const std::string& text) {
+        const std::size_t length = std::min<std::size_t>(text.size(), 255);
+        writeU8(out, static_cast<std::uint8_t>(length));
+        out.insert(out.end(), text.begin(), text.begin() + length);
+    }
+
+    // Nombre de booléens, puis 8 par octet
+    void writeBits(std::vector<std::uint8_t>& out, const std::vector<bool>& bits) {
+        writeU16(out, static_cast<std::uint16_t>(bits.size()));
+        std::uint8_t byte = 0;
+        for (std::size_t i = 0; i < bits.size(); i++) {
+            if (bits[i]) byte |= static_cast<std::uint8_t>(1u << (i % 8));
+            if (i % 8 == 7 || i + 1 == bits.size()) {
+                out.push_back(byte);
+                byte = 0;
+            }
+        }
+    }
+
+    class Reader {
+    public:
+        Reader(const std::uint8_t* data, std::size_t size) : data_(data), size_(size), pos_(0), ok_(true) {}
+
+        bool ok() const { return ok_; }
+        bool atEnd() const { return pos_ == size_; }
+
+        std::uint8_t u8() {
+            if (!need(1)) return 0;
+            return data_[pos_++];
+        }
+
+        std::uint16_t u16() {
+            if (!need(2)) return 0;
+            std::uint16_t value = static_cast<std::uint16_t>(data_[pos_] | (data_[pos_ + 1] << 8));
+            pos_ += 2;
+            return value;
+        }
+
+        std::uint32_t u32() {
+            if (!need(4)) return 0;
+            std::uint32_t value = 0;
+            for (int i = 0; i < 4; i++) {
+                value |= static_cast<std::uint32_t>(data_[pos_ + i]) << (i * 8);
+            }
+            pos_ += 4;
+            return value;
+        }
+
+        float f32() {
+            std::uint32_t bits = u32();
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        void bits(std::vector<bool>& out) {
+            std::size_t count = u16();
+            if (!need((count + 7) / 8)) return;
+            out.assign(count, false);
+            for (std::size_t i = 0; i < count; i++) {
+                out[i] = (data_[pos_ + i / 8] >> (i % 8)) & 1u;
+            }
+            pos_ += (count + 7) / 8;
+        }
+
+        void string(std::string& out) {
+            std::size_t length = u8();
+            if (!need(length)) return;
+            out.assign(reinterpret_cast<const char*>(data_ + pos_), length);
+            pos_ += length;
+        }
+
+        void strings(std::vector<std::string>& out) {
+            std::size_t count = u16();
+            if (!need(count)) return; // Au moins un octet de longueur par texte
+            out.resize(count);
+            for (std::string& text : out) {
+                string(text);
+            }
+        }
+
+    private:
+        bool need(std::size_t count) {
+            if (!ok_ || size_ - pos_ < count) ok_ = false;
+            return ok_;
+        }
+
+        const std::uint8_t* data_;
+        std::size_t size_;
+        std::size_t pos_;
+        bool ok_;
+    };
+}
+
+void encodeSnapshot(const GameSnapshot& snapshot, std::vector<std::uint8_t>& out) {
+    out.clear();
+
+    // Champs de taille fixe d'abord : deux captures successives restent alignées
+    writeU8(out, snapshot.state);
+    writeU8(out, static_cast<std::uint8_t>((snapshot.gameFinished ? 1u : 0u) | (snapshot.creditsStarted ? 2u : 0u)));
+    writeU8(out, snapshot.playerDirection);
+    writeF32(out, snapshot.playerPosition.x);
+    writeF32(out, snapshot.playerPosition.y);
+    writeF32(out, snapshot.gameTime);
+    writeF32(out, snapshot.creditsScroll);
+    writeU32(out, snapshot.dialoguePosition);
+    writeBits(out, snapshot.dialogueFlags);
+
+    writeString(out, snapshot.area);
+    writeString(out, snapshot.dialogueLabel);
+    writeU16(out, static_cast<std::uint16_t>(snapshot.npcShown.size()));
+    for (const std::string& key : snapshot.npcShown) {
+        writeString(out, key);
+    }
+}
+
+bool decodeSnapshot(const std::uint8_t* data, std::size_t size, GameSnapshot& snapshot) {
+    Reader in(data, size);
+
+    snapshot.state = in.u8();
+    std::uint8_t flags = in.u8();
+    snapshot.gameFinished = (flags & 1u) != 0;
+    snapshot.creditsStarted = (flags & 2u) != 0;
+    snapshot.playerDirection = in.u8();
+    snapshot.playerPosition.x = in.f32();
+    snapshot.playerPosition.y = in.f32();
+    snapshot.gameTime = in.f32();
+    snapshot.creditsScroll = in.f32();
+    snapshot.dialoguePosition = in.u32();
+    in.bits(snapshot.dialogueFlags);
+    in.string(snapshot.area);
+    in.string(snapshot.dialogueLabel);
+    in.strings(snapshot.npcShown);
+
+    return in.ok() && in.atEnd();
+}
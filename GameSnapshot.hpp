@@ -0,0 +1,32 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// État complet d'une partie à un instant : tout ce qu'il faut pour la
+// reprendre exactement (le reste est reconstruit au démarrage).
+// Les vecteurs gardent leur capacité : capturer dans le même objet
+// d'une frame à l'autre n'alloue rien.
+struct GameSnapshot {
+    std::uint8_t state = 0;             // GameState
+    bool gameFinished = false;
+    bool creditsStarted = false;
+    std::uint8_t playerDirection = 0;   // Direction
+    sf::Vector2f playerPosition;
+    float gameTime = 0.f;
+    float creditsScroll = 0.f;
+    std::uint32_t dialoguePosition = 0; // Noeud affiché dans le script
+    std::vector<bool> dialogueFlags;
+    std::string area;
+    // Les NPCs sont désignés par zone et étiquette de dialogue, pas par
+    // entité ni par indice : ils sont recréés quand un fichier de zone change
+    std::string dialogueLabel;          // NPC de la conversation ouverte, dans area ("" : aucune)
+    std::vector<std::string> npcShown;  // NPCs déjà rencontrés : "zone/étiquette"
+};
+
+// Format binaire compact (petit-boutiste, booléens regroupés en bits).
+// encode() remplace le contenu de out ; decode() renvoie faux si les
+// données sont tronquées ou incohérentes.
+void encodeSnapshot(const GameSnapshot& snapshot, std::vector<std::uint8_t>& out);
+bool decodeSnapshot(const std::uint8_t* data, std::size_t size, GameSnapshot& snapshot);
@@ -0,0 +1,88 @@
+#include "GameStates.hpp"
+#include "Game.hpp"
+
+// ---------- Menu ----------
+
+void MenuState::handleActions(const InputMap& input) {
+    if (input.wasPressed(Action::Confirm)) {
+        game_.states_.replace(GameState::Playing);
+    }
+    else if (input.wasPressed(Action::Language)) {
+        game_.toggleLocale();
+    }
+}
+
+void MenuState::handleClick(sf::Vector2f position) {
+    if (game_.playButtonRect_.getGlobalBounds().contains(position)) {
+        game_.states_.replace(GameState::Playing);
+    }
+}
+
+void MenuState::render(sf::RenderTarget& target) {
+    game_.renderMenu(target);
+}
+
+// ---------- Partie ----------
+
+void PlayingState::handleActions(const InputMap& input) {
+    // Sauvegarde - F5 (pas pendant une transition, la zone change)
+    if (input.wasPressed(Action::QuickSave) && !game_.transition_.isActive()) {
+        game_.saveGame();
+    }
+    // Pause - on ne traite pas l'interaction de la même frame
+    if (input.wasPressed(Action::Pause)) {
+        game_.states_.push(GameState::Paused);
+        return;
+    }
+    game_.handleDialogueActions();
+}
+
+void PlayingState::update(sf::Time dt) {
+    game_.updatePlaying(dt);
+}
+
+void PlayingState::render(sf::RenderTarget& target) {
+    game_.renderWorld(target);
+}
+
+// ---------- Pause ----------
+
+void PausedState::handleActions(const InputMap& input) {
+    if (input.wasPressed(Action::Pause)) {
+        game_.states_.pop();
+    }
+    else if (input.wasPressed(Action::Language)) {
+        // Le HUD de l'image figée change de langue lui aussi
+        game_.toggleLocale();
+        game_.states_.refreshFrozen();
+    }
+}
+
+void PausedState::handleClick(sf::Vector2f position) {
+    if (game_.resumeButtonRect_.getGlobalBounds().contains(position)) {
+        game_.states_.pop();
+    }
+    else if (game_.quitButtonRect_.getGlobalBounds().contains(position)) {
+        // Réinitialiser le jeu et retourner au menu
+        game_.resetGame();
+        game_.states_.reset(GameState::Menu);
+    }
+}
+
+void PausedState::render(sf::RenderTarget& target) {
+    game_.renderPauseMenu(target);
+}
+
+// ---------- Crédits ----------
+
+void CreditsState::update(sf::Time dt) {
+    // Si tous les crédits sont passés, retourner au menu
+    if (game_.updateCredits(dt)) {
+        game_.resetGame();
+        game_.states_.reset(GameState::Menu);
+    }
+}
+
+void CreditsState::render(sf::RenderTarget& target) {
+    game_.renderCredits(target);
+}
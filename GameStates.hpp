@@ -0,0 +1,55 @@
+#pragma once
+#include "StateStack.hpp"
+
+class Game;
+
+// Les écrans du jeu, empilés dans Game::states_. Ils agissent sur la partie
+// à travers Game (amis de la classe) : la logique du monde reste dans Game,
+// chaque état ne fait que ce qui lui est propre.
+
+// Menu principal : Jouer (Entrée ou clic), changement de langue
+class MenuState : public IGameState {
+public:
+    explicit MenuState(Game& game) : game_(game) {}
+    void handleActions(const InputMap& input) override;
+    void handleClick(sf::Vector2f position) override;
+    void render(sf::RenderTarget& target) override;
+    bool isAnimated() const override { return false; }
+private:
+    Game& game_;
+};
+
+// Partie en cours : monde, dialogues, transitions entre zones
+class PlayingState : public IGameState {
+public:
+    explicit PlayingState(Game& game) : game_(game) {}
+    void handleActions(const InputMap& input) override;
+    void update(sf::Time dt) override;
+    void render(sf::RenderTarget& target) override;
+private:
+    Game& game_;
+};
+
+// Pause : menu par-dessus l'image figée de la partie, rien n'est mis à jour
+class PausedState : public IGameState {
+public:
+    explicit PausedState(Game& game) : game_(game) {}
+    void handleActions(const InputMap& input) override;
+    void handleClick(sf::Vector2f position) override;
+    void render(sf::RenderTarget& target) override;
+    bool isOverlay() const override { return true; }
+    bool isAnimated() const override { return false; }
+private:
+    Game& game_;
+};
+
+// Générique de fin, puis retour au menu
+class CreditsState : public IGameState {
+public:
+    explicit CreditsState(Game& game) : game_(game) {}
+    void handleActions(const InputMap&) override {}
+    void update(sf::Time dt) override;
+    void render(sf::RenderTarget& target) override;
+private:
+    Game& game_;
+};
@@ -1,13 +1,34 @@
 #include "HUD.hpp"
-#include <sstream>
-#include <iomanip>
+#include "AllocTracker.hpp"
+#include "DrawStats.hpp"
 #include <cmath>
+#include <cstdio>
+
+namespace {
+    // Zone du texte dans la bote de dialogue
+    const sf::Vector2f DIALOGUE_TEXT_POS = { 30.f, 500.f };
+    const float DIALOGUE_TEXT_WIDTH = 730.f;
+    const std::size_t DIALOGUE_LINES = 4;
+    const unsigned DIALOGUE_CHAR_SIZE = 16u;
+    // Vitesse de la machine  crire (glyphes par seconde)
+    const float REVEAL_SPEED = 50.f;
+}
 
 HUD::HUD()
-    : gameTime_(0.f)
+    : dialoguePage_(0)
+    , revealedGlyphs_(0.f)
+    , newGlyphs_(0)
+    , strings_(nullptr)
+    , areaName_(StringTable::NO_STRING)
+    , instruction_(StringTable::NO_STRING)
+    , talkHint_(StringTable::NO_STRING)
+    , nolanName_(StringTable::NO_STRING)
+    , gameTime_(0.f)
     , dialogueVisible_(false)
     , interactionAvailable_(false)
     , blinkTime_(0.f)
+    , timerString_("00:00")
+    , shownSeconds_(0)
 {
     // Bote de dialogue (bas de l'cran)
     dialogueBox_.setSize({ 760.f, 120.f });
@@ -15,6 +36,14 @@ HUD::HUD()
     dialogueBox_.setPosition({ 20.f, 460.f });
     dialogueBox_.setOutlineColor(sf::Color::White);
     dialogueBox_.setOutlineThickness(2.f);
+
+    // Triangle pointe en bas, en bas  droite de la bote
+    moreIndicator_.setRadius(6.f);
+    moreIndicator_.setPointCount(3);
+    moreIndicator_.setFillColor(sf::Color::Yellow);
+    moreIndicator_.setOrigin({ 6.f, 6.f });
+    moreIndicator_.setRotation(sf::degrees(180.f));
+    moreIndicator_.setPosition({ 760.f, 566.f });
 }
 
 void HUD::setFont(const sf::Font& font) {
@@ -26,7 +55,7 @@ void HUD::setFont(const sf::Font& font) {
     areaText_->setPosition({ 10.f, 10.f });
 
     // Timer (en haut  droite)
-    timerText_.emplace(font_, "00:00", 20u);
+    timerText_.emplace(font_, timerString_, 20u);
     timerText_->setFillColor(sf::Color::White);
     timerText_->setPosition({ 700.f, 10.f });
 
@@ -36,7 +65,7 @@ void HUD::setFont(const sf::Font& font) {
     instructionText_->setPosition({ 250.f, 10.f });
 
     // Indicateur d'interaction (centre-bas)
-    interactionHint_.emplace(font_, "Appuie sur E pour parler", 16u);
+    interactionHint_.emplace(font_, "", 16u);
     interactionHint_->setFillColor(sf::Color::Yellow);
     interactionHint_->setPosition({ 270.f, 520.f });
 
@@ -46,24 +75,39 @@ void HUD::setFont(const sf::Font& font) {
     speakerText_->setPosition({ 30.f, 470.f });
     speakerText_->setStyle(sf::Text::Bold);
 
-    // Texte du dialogue
-    dialogueText_.emplace(font_, "", 16u);
-    dialogueText_->setFillColor(sf::Color::White);
-    dialogueText_->setPosition({ 30.f, 500.f });
+    refreshTexts();
 }
 
 void HUD::update(sf::Time dt) {
+    AllocTracker::Scope scope(AllocTag::HUD);
     gameTime_ += dt.asSeconds();
 
-    // Mise  jour du timer
-    int minutes = static_cast<int>(gameTime_) / 60;
-    int seconds = static_cast<int>(gameTime_) % 60;
-    std::ostringstream oss;
-    oss << std::setfill('0') << std::setw(2) << minutes << ":"
-        << std::setfill('0') << std::setw(2) << seconds;
+    // Timer : refait seulement quand la seconde change, caractre par
+    // caractre dans la mme chane (aucune allocation en jeu)
+    int elapsed = static_cast<int>(gameTime_);
+    if (elapsed != shownSeconds_ && timerText_) {
+        shownSeconds_ = elapsed;
+        char buffer[16];
+        int length = std::snprintf(buffer, sizeof(buffer), "%02d:%02d", elapsed / 60, elapsed % 60);
+        if (length > 0 && static_cast<std::size_t>(length) == timerString_.getSize()) {
+            for (int i = 0; i < length; i++) {
+                timerString_[static_cast<std::size_t>(i)] = static_cast<char32_t>(buffer[i]);
+            }
+        }
+        else {
+            timerString_ = buffer; // Plus de 99 minutes
+        }
+        timerText_->setString(timerString_);
+    }
 
-    if (timerText_) {
-        timerText_->setString(oss.str());
+    // Machine  crire : seul un compteur avance, la mise en page est dj faite
+    if (dialogueVisible_) {
+        float glyphs = static_cast<float>(dialogueLayout_.getGlyphCount(dialoguePage_));
+        if (revealedGlyphs_ < glyphs) {
+            std::size_t before = static_cast<std::size_t>(revealedGlyphs_);
+            revealedGlyphs_ = std::min(revealedGlyphs_ + dt.asSeconds() * REVEAL_SPEED, glyphs);
+            newGlyphs_ += static_cast<std::size_t>(revealedGlyphs_) - before;
+        }
     }
 
     // Animation clignotante pour l'indicateur d'interaction
@@ -76,76 +120,129 @@ void HUD::update(sf::Time dt) {
     }
 }
 
-void HUD::draw(sf::RenderWindow& window) {
+void HUD::draw(sf::RenderTarget& target) {
     // Affichage permanent
-    if (areaText_) window.draw(*areaText_);
-    if (timerText_) window.draw(*timerText_);
+    if (areaText_) DrawStats::draw(target, *areaText_);
+    if (timerText_) DrawStats::draw(target, *timerText_);
 
     if (instructionText_ && !instructionText_->getString().isEmpty()) {
-        window.draw(*instructionText_);
+        DrawStats::draw(target, *instructionText_);
     }
 
     // Indicateur d'interaction
     if (interactionAvailable_ && !dialogueVisible_ && interactionHint_) {
-        window.draw(*interactionHint_);
+        DrawStats::draw(target, *interactionHint_);
     }
 
     // Dialogue
     if (dialogueVisible_) {
-        window.draw(dialogueBox_);
-        if (speakerText_) window.draw(*speakerText_);
-        if (dialogueText_) window.draw(*dialogueText_);
+        DrawStats::draw(target, dialogueBox_);
+        if (speakerText_) DrawStats::draw(target, *speakerText_);
+        dialogueLayout_.draw(target, DIALOGUE_TEXT_POS, dialoguePage_, static_cast<std::size_t>(revealedGlyphs_));
+
+        bool pageShown = static_cast<std::size_t>(revealedGlyphs_) >= dialogueLayout_.getGlyphCount(dialoguePage_);
+        if (pageShown && dialoguePage_ + 1 < dialogueLayout_.getPageCount()) {
+            DrawStats::draw(target, moreIndicator_);
+        }
     }
 }
 
-void HUD::setCurrentArea(const std::string& area) {
-    currentArea_ = area;
+void HUD::setStrings(const StringTable* strings) {
+    strings_ = strings;
+    talkHint_ = strings_->getId("hud.talk");
+    nolanName_ = strings_->getId("speaker.nolan");
+    refreshTexts();
+}
 
-    if (!areaText_) return;
+void HUD::refreshTexts() {
+    if (!strings_) return;
+    if (areaText_) areaText_->setString(strings_->getSf(areaName_));
+    if (instructionText_) instructionText_->setString(strings_->getSf(instruction_));
+    if (interactionHint_) interactionHint_->setString(strings_->getSf(talkHint_));
+}
 
-    // Conversion des noms de zones en franais
-    if (area == "maison") {
-        areaText_->setString("Maison de Nolan");
-    }
-    else if (area == "rue") {
-        areaText_->setString("Rue");
-    }
-    else if (area == "rue_manif") {
-        areaText_->setString("Rue (Manifestation)");
-    }
-    else if (area == "gare") {
-        areaText_->setString("Gare");
-    }
-    else if (area == "train_interieur") {
-        areaText_->setString("Dans le train");
-    }
-    else if (area == "ecole") {
-        areaText_->setString("Ecole");
-    }
-    else {
-        areaText_->setString(area);
-    }
+void HUD::setCurrentArea(StringId areaName) {
+    areaName_ = areaName;
+    if (areaText_ && strings_) areaText_->setString(strings_->getSf(areaName_));
 }
 
 void HUD::setGameTime(float seconds) {
     gameTime_ = seconds;
 }
 
-void HUD::showInstruction(const std::string& instruction) {
-    if (instructionText_) {
-        instructionText_->setString(instruction);
+void HUD::showInstruction(StringId instruction) {
+    instruction_ = instruction;
+    if (instructionText_ && strings_) {
+        instructionText_->setString(strings_->getSf(instruction_));
     }
 }
 
-void HUD::showDialogue(const std::string& dialogue, const std::string& speaker) {
+void HUD::showDialogue(std::string_view dialogue, std::string_view speaker) {
+    AllocTracker::Scope scope(AllocTag::HUD);
     dialogueVisible_ = true;
-    if (dialogueText_) dialogueText_->setString(dialogue);
-    if (speakerText_) speakerText_->setString(speaker + " :");
+    setDialogueText(dialogue, sf::Color::White, false);
+    if (speakerText_) speakerText_->setString(sf::String::fromUtf8(speaker.begin(), speaker.end()) + " :");
+}
+
+void HUD::setDialogueText(std::string_view text, sf::Color color, bool italic) {
+    // Mise en page complte une seule fois, puis rvle glyphe par glyphe
+    dialogueLayout_.build(font_, sf::String::fromUtf8(text.begin(), text.end()), DIALOGUE_CHAR_SIZE,
+        DIALOGUE_TEXT_WIDTH, DIALOGUE_LINES, color, italic);
+    dialoguePage_ = 0;
+    revealedGlyphs_ = 0.f;
+}
+
+std::size_t HUD::takeRevealedGlyphs() {
+    std::size_t count = newGlyphs_;
+    newGlyphs_ = 0;
+    return count;
+}
+
+bool HUD::advanceText() {
+    std::size_t glyphs = dialogueLayout_.getGlyphCount(dialoguePage_);
+    if (static_cast<std::size_t>(revealedGlyphs_) < glyphs) {
+        revealedGlyphs_ = static_cast<float>(glyphs);
+        return true;
+    }
+    if (dialoguePage_ + 1 < dialogueLayout_.getPageCount()) {
+        dialoguePage_++;
+        revealedGlyphs_ = 0.f;
+        return true;
+    }
+    return false;
+}
+
+void HUD::showThought(std::string_view thought) {
+    AllocTracker::Scope scope(AllocTag::HUD);
+    dialogueVisible_ = true;
+    setDialogueText(thought, sf::Color(200, 200, 200), true);
+    if (speakerText_) speakerText_->setString("");
+}
+
+void HUD::showChoices(const std::string_view* choices, std::size_t count) {
+    AllocTracker::Scope scope(AllocTag::HUD);
+    dialogueVisible_ = true;
+
+    // Une ligne par choix : "1. texte"
+    sf::String text;
+    for (std::size_t i = 0; i < count; i++) {
+        if (i > 0) text += "\n";
+        text += std::to_string(i + 1) + ". ";
+        text += sf::String::fromUtf8(choices[i].begin(), choices[i].end());
+    }
+
+    // Les choix s'affichent directement, sans machine  crire
+    dialogueLayout_.build(font_, text, DIALOGUE_CHAR_SIZE, DIALOGUE_TEXT_WIDTH, DIALOGUE_LINES, sf::Color::Yellow, false);
+    dialoguePage_ = 0;
+    revealedGlyphs_ = static_cast<float>(dialogueLayout_.getGlyphCount(0));
+    if (speakerText_ && strings_) speakerText_->setString(strings_->getSf(nolanName_) + " :");
 }
 
 void HUD::hideDialogue() {
     dialogueVisible_ = false;
-    if (dialogueText_) dialogueText_->setString("");
+    dialogueLayout_.clear();
+    dialoguePage_ = 0;
+    revealedGlyphs_ = 0.f;
     if (speakerText_) speakerText_->setString("");
 }
 
@@ -2,24 +2,39 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <optional>
+#include "TextLayout.hpp"
+#include "StringTable.hpp"
 
 class HUD {
 public:
     HUD();  // Constructeur sans paramtres
     void setFont(const sf::Font& font);  // Ajout de setFont()
+    void setStrings(const StringTable* strings);
+    // Changement de langue : remet les textes affichs, sans rien recrer
+    void refreshTexts();
     void update(sf::Time dt);
-    void draw(sf::RenderWindow& window);
+    void draw(sf::RenderTarget& target);
 
     // Setters pour mettre  jour les infos affiches
-    void setCurrentArea(const std::string& area);
+    void setCurrentArea(StringId areaName);
     void setGameTime(float seconds);
-    void showInstruction(const std::string& instruction);
-    void showDialogue(const std::string& dialogue, const std::string& speaker);
+    void showInstruction(StringId instruction);   // NO_STRING pour l'effacer
+    void showDialogue(std::string_view dialogue, std::string_view speaker);
+    // Pense de Nolan ou narration : en italique, sans nom
+    void showThought(std::string_view thought);
+    // Choix numrots (touches 1, 2, ...)
+    void showChoices(const std::string_view* choices, std::size_t count);
     void hideDialogue();
+    // Touche E pendant un dialogue : affiche d'un coup la page en cours,
+    // sinon passe  la page suivante. Faux quand tout a dj t lu.
+    bool advanceText();
     void setInteractionAvailable(bool available);
 
     // Getter
     bool isDialogueShown() const { return dialogueVisible_; }
+    // Glyphes apparus depuis le dernier appel (bips de la machine  crire)
+    std::size_t takeRevealedGlyphs();
+    float getGameTime() const { return gameTime_; }
 
 private:
     sf::Font font_;
@@ -28,19 +43,37 @@ private:
     std::optional<sf::Text> areaText_;
     std::optional<sf::Text> timerText_;
     std::optional<sf::Text> instructionText_;
-    std::optional<sf::Text> dialogueText_;
     std::optional<sf::Text> speakerText_;
     std::optional<sf::Text> interactionHint_;
 
     // Fond pour le dialogue
     sf::RectangleShape dialogueBox_;
+    sf::CircleShape moreIndicator_;     // Flche "page suivante"
+
+    // Texte du dialogue, mis en page une fois par rplique puis rvl
+    TextLayout dialogueLayout_;
+    std::size_t dialoguePage_;
+    float revealedGlyphs_;
+    std::size_t newGlyphs_;
+
+    // Textes traduits affichs
+    const StringTable* strings_;
+    StringId areaName_;
+    StringId instruction_;
+    StringId talkHint_;
+    StringId nolanName_;
 
     // tat
-    std::string currentArea_;
     float gameTime_;
     bool dialogueVisible_;
     bool interactionAvailable_;
+
+    void setDialogueText(std::string_view text, sf::Color color, bool italic);
     
     // Animation pour l'indicateur d'interaction
     float blinkTime_;
+
+    // Texte du timer, modifi sur place (voir update)
+    sf::String timerString_;
+    int shownSeconds_;
 };
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include "HotReload.hpp"
+#include "AllocTracker.hpp"
+#include <iostream>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const char* const CATALOG_PATHS[LOCALE_COUNT] = { "assets/lang/fr.lang", "assets/lang/en.lang" };
+    const char* const DIALOGUE_PATH = "assets/dialogues/npcs.dlg";
+    const char* const WATCHED_DIRECTORIES[] = { AREA_DIRECTORY, "assets/lang", "assets/dialogues" };
+    const std::chrono::milliseconds POLL_INTERVAL(100);
+}
+
+bool loadTexts(StringTable& strings, DialogueScript& dialogues) {
+    AllocTracker::Scope scope(AllocTag::Data);
+    bool ok = true;
+    for (std::size_t l = 0; l < LOCALE_COUNT; l++) {
+        ok = strings.loadCatalog(static_cast<Locale>(l), CATALOG_PATHS[l]) && ok;
+    }
+    ok = dialogues.loadFromFile(DIALOGUE_PATH, strings) && ok;
+    strings.compile();
+    return ok;
+}
+
+HotReload::HotReload()
+#ifdef __linux__
+    : inotify_(-1)
+    , stop_(false)
+#else
+    : stop_(false)
+#endif
+{
+}
+
+HotReload::~HotReload() {
+    if (worker_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_one();
+        worker_.join();
+    }
+#ifdef __linux__
+    if (inotify_ >= 0) close(inotify_);
+#endif
+}
+
+void HotReload::start(const std::vector<std::string>& keys) {
+    if (worker_.joinable()) return;
+    keys_ = keys;
+
+#ifdef __linux__
+    // Fin d'écriture, ou fichier remplacé (les éditeurs qui écrivent une copie puis la renomment)
+    inotify_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_ < 0) {
+        std::cerr << "Surveillance des fichiers impossible (inotify)\n";
+        return;
+    }
+    for (const char* directory : WATCHED_DIRECTORIES) {
+        int watch = inotify_add_watch(inotify_, directory, IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (watch < 0) std::cerr << "Dossier non surveille : " << directory << "\n";
+        else watches_[watch] = directory;
+    }
+#else
+    // Dates de départ : seules les modifications suivantes comptent
+    std::set<std::string> ignored;
+    collect(ignored);
+#endif
+
+    worker_ = std::thread(&HotReload::workerLoop, this);
+}
+
+void HotReload::receive(std::vector<Reloaded>& out) {
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) return;
+    for (Reloaded& reloaded : done_) {
+        out.push_back(std::move(reloaded));
+    }
+    done_.clear();
+}
+
+bool HotReload::wait(std::chrono::milliseconds interval) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return !wake_.wait_for(lock, interval, [this] { return stop_; });
+}
+
+void HotReload::collect(std::set<std::string>& changed) {
+#ifdef __linux__
+    alignas(inotify_event) char buffer[4096];
+    for (;;) {
+        const ssize_t length = read(inotify_, buffer, sizeof(buffer));
+        if (length <= 0) return;
+        for (char* p = buffer; p < buffer + length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(p);
+            auto watch = watches_.find(event->wd);
+            if (event->len > 0 && watch != watches_.end()) {
+                changed.insert((std::filesystem::path(watch->second) / event->name).string());
+            }
+            p += sizeof(inotify_event) + event->len;
+        }
+    }
+#else
+    std::error_code error;
+    for (const char* directory : WATCHED_DIRECTORIES) {
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+            const std::filesystem::file_time_type time = entry.last_write_time(error);
+            if (error) continue;
+            auto [it, added] = times_.try_emplace(entry.path().string(), time);
+            if (added || it->second != time) {
+                it->second = time;
+                changed.insert(entry.path().string());
+            }
+        }
+    }
+#endif
+}
+
+void HotReload::rebuild(const std::set<std::string>& changed) {
+    std::vector<Reloaded> results;
+    bool texts = false;
+    for (const std::string& path : changed) {
+        const std::filesystem::path file(path);
+        if (file.extension() == AREA_EXTENSION) {
+            Reloaded reloaded;
+            reloaded.area = file.stem().string();
+            reloaded.data = std::make_unique<AreaData>();
+            if (loadAreaFile(path, *reloaded.data)) results.push_back(std::move(reloaded));
+            else std::cerr << "Zone non rechargee : " << path << "\n";
+        }
+        else if (file.extension() == ".lang" || file.extension() == ".dlg") {
+            texts = true;
+        }
+    }
+
+    // Catalogues et script vont ensemble : les répliques sont dans les deux
+    if (texts) {
+        Reloaded reloaded;
+        reloaded.strings = std::make_unique<StringTable>();
+        reloaded.dialogues = std::make_unique<DialogueScript>();
+        reloaded.strings->addKeys(keys_);
+        if (loadTexts(*reloaded.strings, *reloaded.dialogues)) {
+            keys_ = reloaded.strings->getKeys();
+            results.push_back(std::move(reloaded));
+        }
+        else {
+            std::cerr << "Textes non recharges\n";
+        }
+    }
+
+    if (results.empty()) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Reloaded& reloaded : results) {
+        done_.push_back(std::move(reloaded));
+    }
+}
+
+void HotReload::workerLoop() {
+    AllocTracker::setThreadTag(AllocTag::Data);
+    std::set<std::string> changed;
+    while (wait(POLL_INTERVAL)) {
+        collect(changed);
+        if (changed.empty()) continue;
+
+        // Un éditeur enregistre parfois en plusieurs écritures : on laisse
+        // passer un intervalle pour relire le fichier une seule fois
+        if (!wait(POLL_INTERVAL)) return;
+        collect(changed);
+        rebuild(changed);
+        changed.clear();
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "AreaFile.hpp"
+#include "DialogueScript.hpp"
+#include "StringTable.hpp"
+
+// Textes du jeu : catalogues de chaque langue, puis le script des dialogues
+// qui ajoute ses répliques (texte de référence) avant que la table soit
+// compilée. Faux si un fichier manque ou contient une erreur
+bool loadTexts(StringTable& strings, DialogueScript& dialogues);
+
+// Données relues après une modification sur le disque
+struct Reloaded {
+    std::string area;                               // Zone relue, "" : les textes
+    std::unique_ptr<AreaData> data;
+    std::unique_ptr<StringTable> strings;
+    std::unique_ptr<DialogueScript> dialogues;
+};
+
+// Surveille les fichiers de données (zones, catalogues, dialogues) pendant
+// le jeu : inotify sous Linux, dates de modification ailleurs. Un fichier
+// modifié est relu et reconstruit (décor indexé, grille de navigation,
+// table des textes...) par le thread de fond ; le thread principal
+// récupère les résultats dans receive() et les met en place entre deux
+// frames. Un fichier qui contient une erreur n'est pas rechargé : on garde
+// la version précédente.
+class HotReload {
+public:
+    HotReload();
+    ~HotReload();
+    HotReload(const HotReload&) = delete;
+    HotReload& operator=(const HotReload&) = delete;
+
+    // Lance la surveillance. keys : clés de la table des textes actuelle,
+    // qui gardent leur identifiant dans les tables rechargées
+    void start(const std::vector<std::string>& keys);
+
+    // Ajoute à out ce qui a été rechargé depuis le dernier appel
+    // (sans attendre si le thread de fond tient le verrou)
+    void receive(std::vector<Reloaded>& out);
+
+private:
+    // Attend interval ou l'arrêt ; faux à l'arrêt
+    bool wait(std::chrono::milliseconds interval);
+    // Chemins modifiés depuis le dernier appel
+    void collect(std::set<std::string>& changed);
+    void rebuild(const std::set<std::string>& changed);
+    void workerLoop();
+
+    // Thread de fond
+    std::vector<std::string> keys_;
+#ifdef __linux__
+    int inotify_;
+    std::unordered_map<int, std::string> watches_;  // Descripteur -> dossier surveillé
+#else
+    std::unordered_map<std::string, std::filesystem::file_time_type> times_;
+#endif
+
+    // Partagé avec le thread principal (protégé par mutex_)
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<Reloaded> done_;
+    bool stop_;
+
+    std::thread worker_;
+};
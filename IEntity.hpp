@@ -1,17 +0,0 @@
-#pragma once
-#include <SFML/Graphics.hpp>
-
-// Classe abstraite pour toutes les entités du jeu
-class IEntity {
-public:
-    virtual ~IEntity() = default;
-
-    virtual void update(sf::Time dt) = 0; //Met a jour l'entité chaque frame
-    virtual void draw(sf::RenderWindow& window) = 0;
-    virtual sf::FloatRect getGlobalBounds() const = 0;
-
-    // Méthodes virtuelles simples
-    virtual void setPosition(sf::Vector2f pos) = 0;
-    virtual sf::Vector2f getPosition() const = 0;
-
-};
@@ -0,0 +1,217 @@
+#include "InputMap.hpp"
+#include <algorithm>
+
+namespace {
+    // Boutons d'une manette type Xbox (numérotation SFML)
+    const unsigned BUTTON_A = 0;
+    const unsigned BUTTON_B = 1;
+    const unsigned BUTTON_X = 2;
+    const unsigned BUTTON_Y = 3;
+    const unsigned BUTTON_BACK = 6;
+    const unsigned BUTTON_START = 7;
+
+    std::size_t keyIndex(sf::Keyboard::Key key) {
+        return static_cast<std::size_t>(static_cast<int>(key));
+    }
+
+    bool isValidKey(sf::Keyboard::Key key) {
+        return key != sf::Keyboard::Key::Unknown && keyIndex(key) < sf::Keyboard::KeyCount;
+    }
+}
+
+InputMap::InputMap()
+    : held_(0)
+    , injectedDown_(0)
+    , pressed_(0)
+{
+    keyDown_.fill(false);
+    buttonDown_.fill(0);
+    holdCount_.fill(0);
+    stick_.fill(0);
+    resetBindings();
+}
+
+void InputMap::resetBindings() {
+    keyActions_.fill(0);
+    buttonActions_.fill(0);
+
+    using Key = sf::Keyboard::Key;
+    bindKey(Action::MoveUp, Key::Z);
+    bindKey(Action::MoveUp, Key::Up);
+    bindKey(Action::MoveDown, Key::S);
+    bindKey(Action::MoveDown, Key::Down);
+    bindKey(Action::MoveLeft, Key::Q);
+    bindKey(Action::MoveLeft, Key::Left);
+    bindKey(Action::MoveRight, Key::D);
+    bindKey(Action::MoveRight, Key::Right);
+    bindKey(Action::Interact, Key::E);
+    bindKey(Action::Choice1, Key::Num1);
+    bindKey(Action::Choice2, Key::Num2);
+    bindKey(Action::Choice3, Key::Num3);
+    bindKey(Action::Choice4, Key::Num4);
+    bindKey(Action::Confirm, Key::Enter);
+    bindKey(Action::Pause, Key::Escape);
+    bindKey(Action::Language, Key::L);
+    bindKey(Action::QuickSave, Key::F5);
+    bindKey(Action::QuickLoad, Key::F9);
+    bindKey(Action::Rewind, Key::F6);
+    bindKey(Action::RewindFast, Key::LShift);
+    bindKey(Action::RewindFast, Key::RShift);
+    bindKey(Action::DebugOverlay, Key::F3);
+
+    // A parle et choisit la première réponse, B/X/Y les suivantes
+    bindButton(Action::Interact, BUTTON_A);
+    bindButton(Action::Confirm, BUTTON_A);
+    bindButton(Action::Choice1, BUTTON_A);
+    bindButton(Action::Choice2, BUTTON_B);
+    bindButton(Action::Choice3, BUTTON_X);
+    bindButton(Action::Choice4, BUTTON_Y);
+    bindButton(Action::Confirm, BUTTON_START);
+    bindButton(Action::Pause, BUTTON_START);
+    bindButton(Action::Language, BUTTON_BACK);
+}
+
+void InputMap::bindKey(Action action, sf::Keyboard::Key key) {
+    if (isValidKey(key)) keyActions_[keyIndex(key)] |= bit(action);
+}
+
+void InputMap::bindButton(Action action, unsigned button) {
+    if (button < buttonActions_.size()) buttonActions_[button] |= bit(action);
+}
+
+void InputMap::unbind(Action action) {
+    for (ActionSet& actions : keyActions_) actions &= ~bit(action);
+    for (ActionSet& actions : buttonActions_) actions &= ~bit(action);
+}
+
+void InputMap::beginFrame() {
+    pressed_ = 0;
+
+    for (const Injected& input : injected_) {
+        if (input.down) {
+            pressed_ |= bit(input.action);
+            injectedDown_ |= bit(input.action);
+        }
+        else {
+            injectedDown_ &= ~bit(input.action);
+        }
+    }
+    injected_.clear();
+}
+
+void InputMap::inject(Action action, bool down) {
+    injected_.push_back({ action, down });
+}
+
+void InputMap::replay(ActionSet down, ActionSet pressed) {
+    releaseAll();
+    injected_.clear();
+    injectedDown_ = down;
+    pressed_ = pressed;
+}
+
+void InputMap::handleEvent(const sf::Event& event) {
+    if (auto key = event.getIf<sf::Event::KeyPressed>()) {
+        if (!isValidKey(key->code)) return;
+        const std::size_t index = keyIndex(key->code);
+        // Une répétition compte comme un appui, mais ne maintient pas l'action une fois de plus
+        pressed_ |= keyActions_[index];
+        if (!keyDown_[index]) {
+            keyDown_[index] = true;
+            press(keyActions_[index]);
+        }
+    }
+    else if (auto key = event.getIf<sf::Event::KeyReleased>()) {
+        if (!isValidKey(key->code)) return;
+        const std::size_t index = keyIndex(key->code);
+        if (keyDown_[index]) {
+            keyDown_[index] = false;
+            release(keyActions_[index]);
+        }
+    }
+    else if (auto button = event.getIf<sf::Event::JoystickButtonPressed>()) {
+        if (button->joystickId >= sf::Joystick::Count || button->button >= sf::Joystick::ButtonCount) return;
+        std::uint32_t& down = buttonDown_[button->joystickId];
+        const std::uint32_t mask = std::uint32_t(1) << button->button;
+        if (!(down & mask)) {
+            down |= mask;
+            pressed_ |= buttonActions_[button->button];
+            press(buttonActions_[button->button]);
+        }
+    }
+    else if (auto button = event.getIf<sf::Event::JoystickButtonReleased>()) {
+        if (button->joystickId >= sf::Joystick::Count || button->button >= sf::Joystick::ButtonCount) return;
+        std::uint32_t& down = buttonDown_[button->joystickId];
+        const std::uint32_t mask = std::uint32_t(1) << button->button;
+        if (down & mask) {
+            down &= ~mask;
+            release(buttonActions_[button->button]);
+        }
+    }
+    else if (auto moved = event.getIf<sf::Event::JoystickMoved>()) {
+        if (moved->joystickId < sf::Joystick::Count) setAxis(moved->joystickId, moved->axis, moved->position);
+    }
+    else if (auto disconnected = event.getIf<sf::Event::JoystickDisconnected>()) {
+        // Relâche ce que la manette maintenait
+        const unsigned id = disconnected->joystickId;
+        if (id >= sf::Joystick::Count) return;
+        for (unsigned b = 0; b < sf::Joystick::ButtonCount; b++) {
+            if (buttonDown_[id] & (std::uint32_t(1) << b)) release(buttonActions_[b]);
+        }
+        buttonDown_[id] = 0;
+        stick_[id] = 0;
+    }
+    else if (event.is<sf::Event::FocusLost>()) {
+        releaseAll();
+    }
+}
+
+void InputMap::releaseAll() {
+    keyDown_.fill(false);
+    buttonDown_.fill(0);
+    holdCount_.fill(0);
+    stick_.fill(0);
+    held_ = 0;
+    injectedDown_ = 0;
+}
+
+InputMap::ActionSet InputMap::down() const {
+    ActionSet sticks = 0;
+    for (ActionSet stick : stick_) sticks |= stick;
+    return held_ | sticks | injectedDown_;
+}
+
+void InputMap::press(ActionSet actions) {
+    for (std::size_t i = 0; actions != 0; i++, actions >>= 1) {
+        if ((actions & 1) && holdCount_[i]++ == 0) held_ |= ActionSet(1) << i;
+    }
+}
+
+void InputMap::release(ActionSet actions) {
+    for (std::size_t i = 0; actions != 0; i++, actions >>= 1) {
+        if ((actions & 1) && holdCount_[i] > 0 && --holdCount_[i] == 0) held_ &= ~(ActionSet(1) << i);
+    }
+}
+
+void InputMap::setAxis(unsigned joystick, sf::Joystick::Axis axis, float position) {
+    ActionSet negative, positive;
+    if (axis == sf::Joystick::Axis::X) {
+        negative = bit(Action::MoveLeft);
+        positive = bit(Action::MoveRight);
+    }
+    else if (axis == sf::Joystick::Axis::Y) {
+        negative = bit(Action::MoveUp);
+        positive = bit(Action::MoveDown);
+    }
+    else {
+        return;
+    }
+
+    ActionSet& stick = stick_[joystick];
+    ActionSet direction = 0;
+    if (position <= -AXIS_THRESHOLD) direction = negative;
+    else if (position >= AXIS_THRESHOLD) direction = positive;
+
+    pressed_ |= direction & ~stick;
+    stick = (stick & ~(negative | positive)) | direction;
+}
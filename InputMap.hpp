@@ -0,0 +1,93 @@
+#pragma once
+#include <SFML/Window.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Actions du jeu, indépendantes des touches qui les déclenchent
+enum class Action : std::uint8_t {
+    MoveUp, MoveDown, MoveLeft, MoveRight,
+    Interact,       // Parler à un NPC, avancer dans le dialogue
+    Choice1, Choice2, Choice3, Choice4,
+    Confirm,        // Lancer la partie depuis le menu
+    Pause,
+    Language,
+    QuickSave, QuickLoad,
+    Rewind,         // Débogage : figer la partie et revenir en arrière
+    RewindFast,     // Maintenu : le retour en arrière avance par secondes
+    DebugOverlay,   // Débogage : panneau des mesures (frame, dessins, allocations)
+    Count
+};
+
+// Traduit les événements SFML (clavier, manette) en un ensemble d'actions,
+// un bit par action, mis à jour une fois par frame dans processEvents.
+// Le jeu ne lit plus le clavier : isDown/wasPressed sont de simples tests
+// de bits. Les touches se redéfinissent (bindKey/bindButton), et inject()
+// permet de piloter le jeu sans clavier (tests, démos, simulation).
+class InputMap {
+public:
+    using ActionSet = std::uint32_t;
+    static_assert(static_cast<std::size_t>(Action::Count) <= 32, "ActionSet trop petit");
+
+    InputMap();
+
+    // Touches par défaut : ZQSD/flèches, E, 1-4, Entrée, Échap, L, F5/F9/F6, F3
+    // et une manette type Xbox (stick gauche, A, B, X, Y, Back, Start)
+    void resetBindings();
+    void bindKey(Action action, sf::Keyboard::Key key);
+    void bindButton(Action action, unsigned button);
+    // Retire l'action de toutes ses touches et boutons
+    void unbind(Action action);
+
+    // Début de frame : oublie les appuis de la frame précédente et applique
+    // les entrées injectées depuis
+    void beginFrame();
+    void handleEvent(const sf::Event& event);
+    // Entrée synthétique, appliquée au prochain beginFrame()
+    void inject(Action action, bool down);
+    // Remplace l'état de la frame par celui d'une frame enregistrée (voir
+    // InputSession) : à appeler à la place de beginFrame() et des événements
+    void replay(ActionSet down, ActionSet pressed);
+    // Relâche tout (perte du focus : les relâchements n'arriveront pas)
+    void releaseAll();
+
+    bool isDown(Action action) const { return (down() & bit(action)) != 0; }
+    // Appuyé pendant cette frame (les répétitions du clavier comptent)
+    bool wasPressed(Action action) const { return (pressed_ & bit(action)) != 0; }
+    ActionSet getDown() const { return down(); }
+    ActionSet getPressed() const { return pressed_; }
+
+    static ActionSet bit(Action action) { return ActionSet(1) << static_cast<unsigned>(action); }
+
+private:
+    struct Injected {
+        Action action;
+        bool down;
+    };
+
+    ActionSet down() const;
+    void press(ActionSet actions);
+    void release(ActionSet actions);
+    void setAxis(unsigned joystick, sf::Joystick::Axis axis, float position);
+
+    static constexpr std::size_t ACTION_COUNT = static_cast<std::size_t>(Action::Count);
+    static constexpr float AXIS_THRESHOLD = 50.f; // Zone morte du stick (position sur 100)
+
+    // Actions de chaque touche et de chaque bouton de manette
+    std::array<ActionSet, sf::Keyboard::KeyCount> keyActions_;
+    std::array<ActionSet, sf::Joystick::ButtonCount> buttonActions_;
+
+    // Touches et boutons enfoncés (pour ignorer les répétitions)
+    std::array<bool, sf::Keyboard::KeyCount> keyDown_;
+    std::array<std::uint32_t, sf::Joystick::Count> buttonDown_;
+
+    // Nombre de sources qui maintiennent chaque action : Z et Haut peuvent
+    // être enfoncées ensemble, relâcher l'une ne relâche pas l'action
+    std::array<std::uint8_t, ACTION_COUNT> holdCount_;
+    ActionSet held_;
+    std::array<ActionSet, sf::Joystick::Count> stick_;  // Directions du stick de chaque manette
+    ActionSet injectedDown_;
+    ActionSet pressed_;
+
+    std::vector<Injected> injected_;
+};
@@ -0,0 +1,81 @@
+#include "InputSession.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    const char* const HEADER = "# session nolan";
+}
+
+bool InputSession::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Impossible d'ouvrir la session : " << path << "\n";
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line.rfind(HEADER, 0) != 0) {
+        std::cerr << path << " : ce n'est pas une session\n";
+        return false;
+    }
+    int version = 0;
+    std::istringstream(line.substr(std::string(HEADER).size())) >> version;
+    if (version != VERSION) {
+        std::cerr << path << " : version de session inconnue (" << version << ")\n";
+        return false;
+    }
+
+    frames_.clear();
+    int lineNumber = 1;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        std::istringstream in(line);
+        std::string first;
+        if (!(in >> first) || first[0] == '#') continue;
+
+        SessionFrame frame{ sf::Time::Zero, 0, 0, std::nullopt };
+        std::int64_t micros = 0;
+        std::string keyword;
+        std::istringstream(first) >> micros;
+        if (micros < 0 || !(in >> std::hex >> frame.down >> frame.pressed >> std::dec)) {
+            std::cerr << path << ":" << lineNumber << " : frame invalide\n";
+            return false;
+        }
+        if (in >> keyword) {
+            sf::Vector2f position;
+            if (keyword != "click" || !(in >> position.x >> position.y)) {
+                std::cerr << path << ":" << lineNumber << " : clic invalide\n";
+                return false;
+            }
+            frame.click = position;
+        }
+        frame.dt = sf::microseconds(micros);
+        frames_.push_back(frame);
+    }
+    return true;
+}
+
+bool InputSession::save(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Impossible d'écrire la session : " << path << "\n";
+        return false;
+    }
+
+    file << HEADER << " " << VERSION << "\n";
+    for (const SessionFrame& frame : frames_) {
+        file << frame.dt.asMicroseconds() << std::hex << " " << frame.down << " " << frame.pressed << std::dec;
+        if (frame.click) file << " click " << frame.click->x << " " << frame.click->y;
+        file << "\n";
+    }
+    return static_cast<bool>(file);
+}
+
+sf::Time InputSession::getDuration() const {
+    sf::Time total = sf::Time::Zero;
+    for (const SessionFrame& frame : frames_) {
+        total += frame.dt;
+    }
+    return total;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "InputMap.hpp"
+
+// Une frame enregistrée : sa durée et l'état des actions (voir InputMap)
+struct SessionFrame {
+    sf::Time dt;
+    InputMap::ActionSet down;
+    InputMap::ActionSet pressed;
+    std::optional<sf::Vector2f> click;  // Clic sur un bouton, en coordonnées de la vue
+};
+
+// Partie enregistrée frame par frame, pour la rejouer sans fenêtre
+// (simulation, entraînement du PGO, mesures de performance).
+// Fichier texte, une frame par ligne après l'en-tête :
+//   # session nolan 1
+//   <dt en µs> <actions maintenues> <actions appuyées> [click <x> <y>]
+// les ensembles d'actions en hexadécimal. Les lignes vides et les
+// commentaires (#) sont ignorés.
+class InputSession {
+public:
+    static constexpr int VERSION = 1;
+
+    void clear() { frames_.clear(); }
+    void add(const SessionFrame& frame) { frames_.push_back(frame); }
+
+    bool load(const std::string& path);
+    bool save(const std::string& path) const;
+
+    const std::vector<SessionFrame>& getFrames() const { return frames_; }
+    std::size_t size() const { return frames_.size(); }
+    // Temps de jeu total
+    sf::Time getDuration() const;
+
+private:
+    std::vector<SessionFrame> frames_;
+};
@@ -1,8 +1,25 @@
 #include "Game.hpp"
+#include <cstdlib>
+#include <cstring>
 
-int main()
+// Options : --vsync (synchronisation verticale) ou --fps N (60 par défaut),
+// --record FICHIER pour enregistrer la partie (à rejouer avec nolan_sim)
+int main(int argc, char* argv[])
 {
     Game game;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--vsync") == 0) {
+            game.setFramePacing(PacingPolicy::VSync);
+        }
+        else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            int fps = std::atoi(argv[++i]);
+            if (fps > 0) game.setFramePacing(PacingPolicy::TargetFps, static_cast<unsigned>(fps));
+            else std::cerr << "Fréquence invalide : " << argv[i] << "\n";
+        }
+        else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            game.recordSession(argv[++i]);
+        }
+    }
     game.run();
     return 0;
 }
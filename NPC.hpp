@@ -1,7 +1,7 @@
 #pragma once
-#include "IEntity.hpp"
-#include <string>
-#include <vector>
+#include <cstdint>
+#include <string_view>
+#include "World.hpp"
 
 enum class NPCType {
     Parent,      // Parent dans la maison
@@ -14,36 +14,22 @@ enum class NPCType {
     NPCgare,
 };
 
-class NPC : public IEntity {
-public:
-    NPC(sf::Vector2f position, NPCType type, const std::vector<std::string>& dialogues);
-    NPC(sf::Vector2f position, NPCType type, const std::string& singleDialogue);
-
-    void update(sf::Time dt) override;
-    void draw(sf::RenderWindow& window) override;
-    sf::FloatRect getGlobalBounds() const override;
-    void setPosition(sf::Vector2f pos) override;
-    sf::Vector2f getPosition() const override;
+// Nom du type dans les fichiers de zones, dans l'ordre de NPCType
+constexpr std::string_view NPC_TYPE_NAMES[] = {
+    "parent", "manifestant", "controleur", "ami", "passant", "agent", "passager", "voyageur"
+};
+constexpr std::size_t NPC_TYPE_COUNT = sizeof(NPC_TYPE_NAMES) / sizeof(NPC_TYPE_NAMES[0]);
 
-    // Mthodes spcifiques aux NPCs
-    std::string getCurrentDialogue() const;
-    void advanceDialogue();
-    bool hasMoreDialogues() const;
-    NPCType getType() const { return type_; }
-    bool isInRange(const sf::FloatRect& playerBounds) const;
-    void setDialogueShown(bool shown) { dialogueShown_ = shown; }
-    bool isDialogueShown() const { return dialogueShown_; }
-    void resetDialogue() { currentDialogueIndex_ = 0; dialogueShown_ = false; }
+// Cl du nom affich au-dessus des rpliques, dans l'ordre de NPCType
+constexpr std::string_view SPEAKER_KEYS[] = {
+    "speaker.parent", "speaker.manifestant", "speaker.controleur", "speaker.ami",
+    "speaker.passant", "speaker.agent", "speaker.passager", "speaker.voyageur"
+};
+constexpr std::size_t SPEAKER_COUNT = sizeof(SPEAKER_KEYS) / sizeof(SPEAKER_KEYS[0]);
 
-private:
-    sf::RectangleShape shape_;
-    sf::Vector2f position_;
-    NPCType type_;
-    std::vector<std::string> dialogues_;
-    int currentDialogueIndex_;
-    bool dialogueShown_;
+// Taille du corps de tous les NPCs (grilles de navigation comprises)
+inline const sf::Vector2f NPC_SIZE(30.f, 40.f);
 
-    // Animation simple
-    float animationTime_;
-    float bobOffset_; // Pour faire "bouger" le NPC
-};
\ No newline at end of file
+// Cre un NPC : corps color selon son type, balancement, dialogue et
+// zone d'interaction. dialogueEntry : point d'entre dans le script de dialogues
+Entity spawnNPC(World& world, sf::Vector2f position, NPCType type, std::uint32_t dialogueEntry);
@@ -0,0 +1,111 @@
+#include "NavGrid.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace {
+    const int MAX_SNAP_RADIUS = 4; // En cases
+    // Version commune à toutes les grilles : deux zones n'ont jamais la même
+    // (les grilles rechargées sont construites sur un autre thread)
+    std::atomic<std::uint32_t> nextVersion{ 1 };
+}
+
+NavGrid::NavGrid(float cellSize)
+    : cellSize_(cellSize)
+    , width_(0)
+    , height_(0)
+    , version_(0)
+{
+}
+
+void NavGrid::build(sf::Vector2f areaSize, const std::vector<sf::FloatRect>& obstacles, sf::Vector2f agentSize) {
+    width_ = std::max(1, static_cast<int>(std::ceil(areaSize.x / cellSize_)));
+    height_ = std::max(1, static_cast<int>(std::ceil(areaSize.y / cellSize_)));
+    walkable_.assign(static_cast<std::size_t>(width_ * height_), 1);
+    version_ = nextVersion++;
+
+    const sf::Vector2f half = agentSize / 2.f;
+
+    // Le personnage ne sort pas de la zone
+    for (int y = 0; y < height_; y++) {
+        for (int x = 0; x < width_; x++) {
+            sf::Vector2f c = getCellCenter(static_cast<std::uint32_t>(y * width_ + x));
+            if (c.x < half.x || c.y < half.y || c.x > areaSize.x - half.x || c.y > areaSize.y - half.y) {
+                walkable_[static_cast<std::size_t>(y * width_ + x)] = 0;
+            }
+        }
+    }
+
+    // Obstacles élargis : on ne teste ensuite que le centre des cases
+    for (const sf::FloatRect& obstacle : obstacles) {
+        const float left = obstacle.position.x - half.x;
+        const float top = obstacle.position.y - half.y;
+        const float right = obstacle.position.x + obstacle.size.x + half.x;
+        const float bottom = obstacle.position.y + obstacle.size.y + half.y;
+
+        const int x0 = std::max(0, static_cast<int>(std::floor(left / cellSize_)));
+        const int y0 = std::max(0, static_cast<int>(std::floor(top / cellSize_)));
+        const int x1 = std::min(width_ - 1, static_cast<int>(std::floor(right / cellSize_)));
+        const int y1 = std::min(height_ - 1, static_cast<int>(std::floor(bottom / cellSize_)));
+        for (int y = y0; y <= y1; y++) {
+            for (int x = x0; x <= x1; x++) {
+                sf::Vector2f c = getCellCenter(static_cast<std::uint32_t>(y * width_ + x));
+                if (c.x > left && c.x < right && c.y > top && c.y < bottom) {
+                    walkable_[static_cast<std::size_t>(y * width_ + x)] = 0;
+                }
+            }
+        }
+    }
+}
+
+std::uint32_t NavGrid::getCell(sf::Vector2f position) const {
+    const int x = static_cast<int>(std::floor(position.x / cellSize_));
+    const int y = static_cast<int>(std::floor(position.y / cellSize_));
+    if (x < 0 || y < 0 || x >= width_ || y >= height_) return NO_CELL;
+    return static_cast<std::uint32_t>(y * width_ + x);
+}
+
+sf::Vector2f NavGrid::getCellCenter(std::uint32_t cell) const {
+    const int x = static_cast<int>(cell) % width_;
+    const int y = static_cast<int>(cell) / width_;
+    return { (static_cast<float>(x) + 0.5f) * cellSize_, (static_cast<float>(y) + 0.5f) * cellSize_ };
+}
+
+std::uint32_t NavGrid::findNearestWalkable(sf::Vector2f position) const {
+    if (walkable_.empty()) return NO_CELL;
+    const int cx = std::clamp(static_cast<int>(std::floor(position.x / cellSize_)), 0, width_ - 1);
+    const int cy = std::clamp(static_cast<int>(std::floor(position.y / cellSize_)), 0, height_ - 1);
+
+    // Anneaux de plus en plus grands autour de la case de départ
+    for (int r = 0; r <= MAX_SNAP_RADIUS; r++) {
+        std::uint32_t best = NO_CELL;
+        float bestDistance = 0.f;
+        for (int y = cy - r; y <= cy + r; y++) {
+            for (int x = cx - r; x <= cx + r; x++) {
+                if (std::max(std::abs(x - cx), std::abs(y - cy)) != r || !isWalkable(x, y)) continue;
+                const std::uint32_t cell = static_cast<std::uint32_t>(y * width_ + x);
+                const sf::Vector2f d = getCellCenter(cell) - position;
+                const float distance = d.x * d.x + d.y * d.y;
+                if (best == NO_CELL || distance < bestDistance) {
+                    best = cell;
+                    bestDistance = distance;
+                }
+            }
+        }
+        if (best != NO_CELL) return best;
+    }
+    return NO_CELL;
+}
+
+bool NavGrid::hasLineOfSight(sf::Vector2f a, sf::Vector2f b) const {
+    // Échantillons tous les quarts de case le long du segment
+    const sf::Vector2f d = b - a;
+    const float length = std::sqrt(d.x * d.x + d.y * d.y);
+    const int steps = std::max(1, static_cast<int>(length / (cellSize_ * 0.25f)));
+    for (int i = 0; i <= steps; i++) {
+        const sf::Vector2f p = a + d * (static_cast<float>(i) / static_cast<float>(steps));
+        const std::uint32_t cell = getCell(p);
+        if (cell == NO_CELL || !walkable_[cell]) return false;
+    }
+    return true;
+}
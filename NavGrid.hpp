@@ -0,0 +1,44 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Grille de navigation d'une zone : une case est praticable si un
+// personnage centré dessus ne touche aucun obstacle statique.
+// Construite une fois par zone (les obstacles sont élargis de la
+// demi-taille du personnage), puis seulement lue par le PathService.
+class NavGrid {
+public:
+    static constexpr std::uint32_t NO_CELL = 0xFFFFFFFFu;
+
+    explicit NavGrid(float cellSize = 20.f);
+
+    // agentSize : taille du corps des personnages qui se déplacent
+    void build(sf::Vector2f areaSize, const std::vector<sf::FloatRect>& obstacles, sf::Vector2f agentSize);
+
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    std::size_t getCellCount() const { return walkable_.size(); }
+    float getCellSize() const { return cellSize_; }
+    // Change à chaque build() et diffère d'une grille à l'autre (clé du cache de chemins)
+    std::uint32_t getVersion() const { return version_; }
+
+    bool isWalkable(int x, int y) const {
+        return x >= 0 && y >= 0 && x < width_ && y < height_ && walkable_[static_cast<std::size_t>(y * width_ + x)];
+    }
+    bool isWalkable(std::uint32_t cell) const { return cell < walkable_.size() && walkable_[cell]; }
+
+    std::uint32_t getCell(sf::Vector2f position) const;
+    sf::Vector2f getCellCenter(std::uint32_t cell) const;
+    // Case praticable la plus proche (dans un rayon de quelques cases), ou NO_CELL
+    std::uint32_t findNearestWalkable(sf::Vector2f position) const;
+    // Aucune case bloquée entre a et b (pour lisser les chemins)
+    bool hasLineOfSight(sf::Vector2f a, sf::Vector2f b) const;
+
+private:
+    float cellSize_;
+    int width_;
+    int height_;
+    std::uint32_t version_;
+    std::vector<std::uint8_t> walkable_;
+};
@@ -0,0 +1,173 @@
+#include "ParticleSystem.hpp"
+#include "AllocTracker.hpp"
+#include "DrawStats.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const float PREWARM_STEP = 1.f / 30.f;
+
+    void setQuad(sf::Vertex* v, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f d, sf::Color color) {
+        // a b / c d : deux triangles
+        v[0] = { a, color, {} };
+        v[1] = { b, color, {} };
+        v[2] = { c, color, {} };
+        v[3] = { c, color, {} };
+        v[4] = { b, color, {} };
+        v[5] = { d, color, {} };
+    }
+}
+
+ParticleSystem::ParticleSystem(std::uint32_t seed)
+    : random_(seed)
+{
+}
+
+ParticleSystem::EmitterId ParticleSystem::addEmitter(const EmitterSettings& settings, std::size_t capacity) {
+    emitters_.emplace_back();
+    const EmitterId id = static_cast<EmitterId>(emitters_.size() - 1);
+    setEmitter(id, settings, capacity);
+    return id;
+}
+
+void ParticleSystem::setEmitter(EmitterId id, const EmitterSettings& settings, std::size_t capacity) {
+    if (id >= emitters_.size()) return;
+    Emitter& emitter = emitters_[id];
+    emitter.settings = settings;
+    if (emitter.settings.palette.empty()) emitter.settings.palette.push_back(sf::Color::White);
+    emitter.capacity = capacity;
+    emitter.count = 0;
+    emitter.spawnDebt = 0.f;
+    emitter.posX.resize(capacity);
+    emitter.posY.resize(capacity);
+    emitter.velX.resize(capacity);
+    emitter.velY.resize(capacity);
+    emitter.age.resize(capacity);
+    emitter.life.resize(capacity);
+    emitter.color.resize(capacity);
+    emitter.batch.resize(capacity * 6);
+}
+
+void ParticleSystem::prewarm(EmitterId id, float seconds) {
+    if (id >= emitters_.size()) return;
+    for (float t = 0.f; t < seconds; t += PREWARM_STEP) {
+        step(emitters_[id], PREWARM_STEP);
+    }
+}
+
+float ParticleSystem::randomRange(float min, float max) {
+    return min < max ? std::uniform_real_distribution<float>(min, max)(random_) : min;
+}
+
+void ParticleSystem::spawn(Emitter& emitter, std::size_t n) {
+    const EmitterSettings& s = emitter.settings;
+    n = std::min(n, emitter.capacity - emitter.count);
+    std::uniform_int_distribution<std::size_t> pick(0, s.palette.size() - 1);
+    for (std::size_t k = 0; k < n; k++) {
+        const std::size_t i = emitter.count++;
+        emitter.posX[i] = randomRange(s.spawn.position.x, s.spawn.position.x + s.spawn.size.x);
+        emitter.posY[i] = randomRange(s.spawn.position.y, s.spawn.position.y + s.spawn.size.y);
+        emitter.velX[i] = randomRange(s.velocityMin.x, s.velocityMax.x);
+        emitter.velY[i] = randomRange(s.velocityMin.y, s.velocityMax.y);
+        emitter.age[i] = 0.f;
+        emitter.life[i] = randomRange(s.lifeMin, s.lifeMax);
+        emitter.color[i] = s.palette[pick(random_)];
+    }
+}
+
+void ParticleSystem::step(Emitter& emitter, float dt) {
+    const EmitterSettings& s = emitter.settings;
+
+    // Mouvement : boucle sans branche sur des tableaux contigus (vectorisée)
+    const std::size_t count = emitter.count;
+    const float damp = std::max(0.f, 1.f - s.drag * dt);
+    const float gx = s.gravity.x * dt;
+    const float gy = s.gravity.y * dt;
+    float* px = emitter.posX.data();
+    float* py = emitter.posY.data();
+    float* vx = emitter.velX.data();
+    float* vy = emitter.velY.data();
+    float* age = emitter.age.data();
+    for (std::size_t i = 0; i < count; i++) {
+        vx[i] = (vx[i] + gx) * damp;
+        vy[i] = (vy[i] + gy) * damp;
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        age[i] += dt;
+    }
+
+    // Les mortes sont remplacées par la dernière vivante
+    std::size_t i = 0;
+    while (i < emitter.count) {
+        if (emitter.age[i] < emitter.life[i]) {
+            i++;
+            continue;
+        }
+        const std::size_t last = --emitter.count;
+        emitter.posX[i] = emitter.posX[last];
+        emitter.posY[i] = emitter.posY[last];
+        emitter.velX[i] = emitter.velX[last];
+        emitter.velY[i] = emitter.velY[last];
+        emitter.age[i] = emitter.age[last];
+        emitter.life[i] = emitter.life[last];
+        emitter.color[i] = emitter.color[last];
+    }
+
+    // Naissances au rythme demandé, tant qu'il reste de la place
+    emitter.spawnDebt += s.rate * dt;
+    const auto births = static_cast<std::size_t>(emitter.spawnDebt);
+    emitter.spawnDebt -= static_cast<float>(births);
+    spawn(emitter, births);
+}
+
+void ParticleSystem::update(const std::vector<EmitterId>& ids, sf::Time dt) {
+    AllocTracker::Scope scope(AllocTag::Particles);
+    const float seconds = dt.asSeconds();
+    if (seconds <= 0.f) return;
+    for (EmitterId id : ids) {
+        if (id < emitters_.size()) step(emitters_[id], seconds);
+    }
+}
+
+void ParticleSystem::draw(sf::RenderTarget& target, const std::vector<EmitterId>& ids) {
+    for (EmitterId id : ids) {
+        if (id >= emitters_.size()) continue;
+        Emitter& emitter = emitters_[id];
+        if (emitter.count == 0) continue;
+        const EmitterSettings& s = emitter.settings;
+
+        sf::Vertex* v = emitter.batch.data();
+        for (std::size_t i = 0; i < emitter.count; i++, v += 6) {
+            const float t = emitter.age[i] / emitter.life[i];
+            const float width = s.sizeStart + (s.sizeEnd - s.sizeStart) * t;
+            sf::Color color = emitter.color[i];
+            if (s.fadeTime > 0.f) {
+                const float fade = std::min(1.f, (emitter.life[i] - emitter.age[i]) / s.fadeTime);
+                color.a = static_cast<std::uint8_t>(color.a * fade);
+            }
+
+            const sf::Vector2f p(emitter.posX[i], emitter.posY[i]);
+            if (s.streak > 0.f) {
+                // Traînée derrière la particule (gouttes de pluie)
+                const sf::Vector2f vel(emitter.velX[i], emitter.velY[i]);
+                const sf::Vector2f tail = p - vel * s.streak;
+                const float length = std::sqrt(vel.x * vel.x + vel.y * vel.y);
+                const sf::Vector2f side = length > 0.f ? sf::Vector2f(-vel.y, vel.x) * (width * 0.5f / length) : sf::Vector2f(width * 0.5f, 0.f);
+                setQuad(v, tail - side, tail + side, p - side, p + side, color);
+            }
+            else {
+                const sf::Vector2f half(width * 0.5f, width * s.aspect * 0.5f);
+                setQuad(v, p - half, { p.x + half.x, p.y - half.y }, { p.x - half.x, p.y + half.y }, p + half, color);
+            }
+        }
+        DrawStats::draw(target, emitter.batch.data(), emitter.count * 6, sf::PrimitiveType::Triangles);
+    }
+}
+
+std::size_t ParticleSystem::getLiveCount() const {
+    std::size_t total = 0;
+    for (const Emitter& emitter : emitters_) {
+        total += emitter.count;
+    }
+    return total;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Réglages d'un émetteur : un effet (pluie, vapeur, confettis...) n'est
+// qu'un jeu de valeurs, pas une sous-classe
+struct EmitterSettings {
+    sf::FloatRect spawn;            // Zone où naissent les particules
+    float rate;                     // Particules par seconde
+    sf::Vector2f velocityMin;
+    sf::Vector2f velocityMax;
+    sf::Vector2f gravity;
+    float drag;                     // Part de la vitesse perdue par seconde
+    float lifeMin;
+    float lifeMax;
+    float sizeStart;                // Largeur à la naissance...
+    float sizeEnd;                  // ... et à la fin de la vie
+    float aspect;                   // Hauteur / largeur (rectangles)
+    float streak;                   // > 0 : traînée le long de la vitesse (longueur = vitesse * streak)
+    float fadeTime;                 // Disparition sur les dernières secondes de vie
+    std::vector<sf::Color> palette; // Couleur tirée au hasard à la naissance
+};
+
+// Particules d'ambiance. Chaque émetteur a une capacité fixe, réservée à
+// sa création : ses particules sont rangées en tableaux parallèles
+// (positions, vitesses, âges...), la mise à jour est un seul passage sans
+// branche et une particule morte est remplacée par la dernière. Rien n'est
+// alloué pendant le jeu. Chaque émetteur est dessiné en un seul appel.
+class ParticleSystem {
+public:
+    using EmitterId = std::uint32_t;
+
+    explicit ParticleSystem(std::uint32_t seed = 11);
+
+    void clear() { emitters_.clear(); }
+    EmitterId addEmitter(const EmitterSettings& settings, std::size_t capacity);
+    // Nouveaux réglages (zone relue) : les particules en vol disparaissent
+    void setEmitter(EmitterId id, const EmitterSettings& settings, std::size_t capacity);
+    // Fait tourner l'émetteur quelques secondes (pluie déjà tombée à l'arrivée)
+    void prewarm(EmitterId id, float seconds);
+
+    // Seuls les émetteurs donnés (ceux de la zone courante) avancent
+    void update(const std::vector<EmitterId>& ids, sf::Time dt);
+    void draw(sf::RenderTarget& target, const std::vector<EmitterId>& ids);
+
+    std::size_t getLiveCount() const;
+
+private:
+    struct Emitter {
+        EmitterSettings settings;
+        std::size_t capacity;
+        std::size_t count;
+        float spawnDebt;            // Fraction de particule à faire naître
+        std::vector<float> posX, posY;
+        std::vector<float> velX, velY;
+        std::vector<float> age, life;
+        std::vector<sf::Color> color;
+        std::vector<sf::Vertex> batch; // 6 sommets par particule, taille fixe
+    };
+
+    void step(Emitter& emitter, float dt);
+    void spawn(Emitter& emitter, std::size_t n);
+    float randomRange(float min, float max);
+
+    std::vector<Emitter> emitters_;
+    std::mt19937 random_;
+};
@@ -0,0 +1,253 @@
+#include "PathService.hpp"
+#include "AllocTracker.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace {
+    // Coûts entiers : 10 en ligne droite, 14 en diagonale
+    const std::uint32_t STRAIGHT_COST = 10;
+    const std::uint32_t DIAGONAL_COST = 14;
+    // Noeuds développés entre deux lectures de l'horloge
+    const int NODES_PER_CLOCK_CHECK = 64;
+
+    const int DX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+    const int DY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+}
+
+PathService::PathService(std::size_t cacheCapacity)
+    : cacheCapacity_(cacheCapacity)
+    , searching_(false)
+    , current_{ nullptr, 0, 0, NO_TICKET, 0 }
+    , generation_(0)
+    , searchCount_(0)
+    , cacheHits_(0)
+{
+}
+
+PathService::Ticket PathService::request(const NavGrid& grid, sf::Vector2f from, sf::Vector2f to) {
+    Ticket ticket;
+    if (!freeSlots_.empty()) {
+        ticket = freeSlots_.back();
+        freeSlots_.pop_back();
+    }
+    else {
+        ticket = static_cast<Ticket>(slots_.size());
+        slots_.push_back({ 0, PathStatus::Pending, false, {} });
+    }
+    Slot& slot = slots_[ticket];
+    slot.used = true;
+    slot.status = PathStatus::Pending;
+    slot.path.clear();
+
+    // Départ ou arrivée dans un obstacle : on part de la case libre la plus proche
+    Request request{ &grid, grid.findNearestWalkable(from), grid.findNearestWalkable(to), ticket, slot.serial };
+    if (request.start == NavGrid::NO_CELL || request.goal == NavGrid::NO_CELL) {
+        slot.status = PathStatus::Failed;
+        return ticket;
+    }
+    queue_.push_back(request);
+    return ticket;
+}
+
+PathStatus PathService::getStatus(Ticket ticket) const {
+    if (ticket >= slots_.size() || !slots_[ticket].used) return PathStatus::Failed;
+    return slots_[ticket].status;
+}
+
+bool PathService::take(Ticket ticket, std::vector<sf::Vector2f>& path) {
+    if (getStatus(ticket) != PathStatus::Ready) {
+        if (getStatus(ticket) == PathStatus::Failed) release(ticket);
+        return false;
+    }
+    path.assign(slots_[ticket].path.begin(), slots_[ticket].path.end());
+    release(ticket);
+    return true;
+}
+
+void PathService::release(Ticket ticket) {
+    if (ticket >= slots_.size() || !slots_[ticket].used) return;
+    Slot& slot = slots_[ticket];
+    slot.used = false;
+    slot.serial++;
+    freeSlots_.push_back(ticket);
+}
+
+void PathService::forget(const NavGrid& grid) {
+    for (const Request& request : queue_) {
+        if (request.grid == &grid) complete(request, false, {});
+    }
+    queue_.erase(std::remove_if(queue_.begin(), queue_.end(),
+        [&grid](const Request& request) { return request.grid == &grid; }), queue_.end());
+    if (searching_ && current_.grid == &grid) {
+        complete(current_, false, {});
+        searching_ = false;
+    }
+}
+
+bool PathService::isCurrent(const Request& request) const {
+    const Slot& slot = slots_[request.ticket];
+    return slot.used && slot.serial == request.serial;
+}
+
+std::uint64_t PathService::makeKey(const Request& request) {
+    return (static_cast<std::uint64_t>(request.grid->getVersion()) << 40)
+        | (static_cast<std::uint64_t>(request.start & 0xFFFFFu) << 20)
+        | (request.goal & 0xFFFFFu);
+}
+
+void PathService::complete(const Request& request, bool found, const std::vector<sf::Vector2f>& path) {
+    if (!isCurrent(request)) return;
+    Slot& slot = slots_[request.ticket];
+    slot.status = found ? PathStatus::Ready : PathStatus::Failed;
+    slot.path.assign(path.begin(), path.end());
+}
+
+void PathService::update(sf::Time budget) {
+    AllocTracker::Scope scope(AllocTag::Paths);
+    const Clock::time_point deadline = Clock::now() + std::chrono::microseconds(budget.asMicroseconds());
+
+    do {
+        if (!searching_) {
+            if (queue_.empty()) return;
+            Request request = queue_.front();
+            queue_.pop_front();
+            if (!isCurrent(request)) continue;
+
+            // Même trajet déjà calculé (ou demandé plus tôt dans la file)
+            auto cached = cache_.find(makeKey(request));
+            if (cached != cache_.end()) {
+                cacheHits_++;
+                complete(request, true, cached->second);
+                continue;
+            }
+            if (request.start == request.goal) {
+                result_.assign(1, request.grid->getCellCenter(request.goal));
+                complete(request, true, result_);
+                continue;
+            }
+            beginSearch(request);
+        }
+
+        // Les premiers noeuds sont toujours développés : la recherche avance
+        // à chaque frame, même si le budget est déjà épuisé
+        bool found = false;
+        if (!stepSearch(deadline, found)) return;
+        searching_ = false;
+
+        result_.clear();
+        if (found) {
+            buildPath(result_);
+            if (cache_.size() >= cacheCapacity_) cache_.clear();
+            cache_[makeKey(current_)] = result_;
+        }
+        complete(current_, found, result_);
+    } while (Clock::now() < deadline);
+}
+
+std::uint32_t PathService::heuristic(std::uint32_t cell) const {
+    // Distance octile jusqu'à l'arrivée
+    const int width = current_.grid->getWidth();
+    const int dx = std::abs(static_cast<int>(cell % width) - static_cast<int>(current_.goal % width));
+    const int dy = std::abs(static_cast<int>(cell / width) - static_cast<int>(current_.goal / width));
+    const auto lo = static_cast<std::uint32_t>(std::min(dx, dy));
+    const auto hi = static_cast<std::uint32_t>(std::max(dx, dy));
+    return DIAGONAL_COST * lo + STRAIGHT_COST * (hi - lo);
+}
+
+void PathService::beginSearch(const Request& request) {
+    current_ = request;
+    searching_ = true;
+    searchCount_++;
+
+    const std::size_t cellCount = request.grid->getCellCount();
+    if (stamp_.size() < cellCount) {
+        stamp_.resize(cellCount, 0);
+        cost_.resize(cellCount);
+        parent_.resize(cellCount);
+        closed_.resize(cellCount);
+    }
+    // Nouvelle génération : les cases marquées par les recherches précédentes
+    // comptent comme jamais vues, sans rien effacer
+    if (++generation_ == 0) {
+        std::fill(stamp_.begin(), stamp_.end(), 0);
+        generation_ = 1;
+    }
+
+    open_.clear();
+    stamp_[request.start] = generation_;
+    cost_[request.start] = 0;
+    parent_[request.start] = NavGrid::NO_CELL;
+    closed_[request.start] = 0;
+    open_.push_back({ heuristic(request.start), request.start });
+}
+
+bool PathService::stepSearch(Clock::time_point deadline, bool& found) {
+    const NavGrid& grid = *current_.grid;
+    const int width = grid.getWidth();
+    int sinceCheck = 0;
+
+    while (!open_.empty()) {
+        if (++sinceCheck >= NODES_PER_CLOCK_CHECK) {
+            sinceCheck = 0;
+            if (Clock::now() >= deadline) return false;
+        }
+
+        std::pop_heap(open_.begin(), open_.end(), std::greater<OpenNode>());
+        const std::uint32_t cell = open_.back().cell;
+        open_.pop_back();
+        if (closed_[cell]) continue; // Entrée périmée (un meilleur coût a été trouvé depuis)
+        closed_[cell] = 1;
+
+        if (cell == current_.goal) {
+            found = true;
+            return true;
+        }
+
+        const int x = static_cast<int>(cell) % width;
+        const int y = static_cast<int>(cell) / width;
+        for (int i = 0; i < 8; i++) {
+            const int nx = x + DX[i];
+            const int ny = y + DY[i];
+            if (!grid.isWalkable(nx, ny)) continue;
+            // En diagonale, les deux cases voisines doivent être libres (pas de coin coupé)
+            if (i >= 4 && (!grid.isWalkable(nx, y) || !grid.isWalkable(x, ny))) continue;
+
+            const auto next = static_cast<std::uint32_t>(ny * width + nx);
+            const std::uint32_t cost = cost_[cell] + (i >= 4 ? DIAGONAL_COST : STRAIGHT_COST);
+            if (stamp_[next] == generation_ && (closed_[next] || cost >= cost_[next])) continue;
+
+            stamp_[next] = generation_;
+            cost_[next] = cost;
+            parent_[next] = cell;
+            closed_[next] = 0;
+            open_.push_back({ cost + heuristic(next), next });
+            std::push_heap(open_.begin(), open_.end(), std::greater<OpenNode>());
+        }
+    }
+    found = false;
+    return true;
+}
+
+void PathService::buildPath(std::vector<sf::Vector2f>& out) {
+    const NavGrid& grid = *current_.grid;
+
+    // Cases de l'arrivée au départ
+    std::vector<std::uint32_t>& cells = cells_;
+    cells.clear();
+    for (std::uint32_t cell = current_.goal; cell != NavGrid::NO_CELL; cell = parent_[cell]) {
+        cells.push_back(cell);
+    }
+    std::reverse(cells.begin(), cells.end());
+
+    // Lissage : depuis chaque point, on va droit au plus loin qu'on voit
+    std::size_t from = 0;
+    while (from + 1 < cells.size()) {
+        std::size_t to = from + 1;
+        const sf::Vector2f origin = grid.getCellCenter(cells[from]);
+        while (to + 1 < cells.size() && grid.hasLineOfSight(origin, grid.getCellCenter(cells[to + 1]))) {
+            to++;
+        }
+        out.push_back(grid.getCellCenter(cells[to]));
+        from = to;
+    }
+}
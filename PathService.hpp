@@ -0,0 +1,98 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+#include "NavGrid.hpp"
+
+enum class PathStatus : std::uint8_t { Pending, Ready, Failed };
+
+// Service de recherche de chemins (A* sur une NavGrid, 8 directions, sans
+// couper les coins). Les demandes sont mises en file et traitées dans
+// update() pendant un temps fixe par frame : une recherche trop longue
+// reprend à la frame suivante là où elle s'était arrêtée.
+// Les chemins trouvés sont gardés en cache (case de départ, case d'arrivée,
+// grille) : les demandes identiques d'une même frame ou des suivantes ne
+// coûtent qu'une recherche. Tous les tableaux de travail sont gardés d'une
+// recherche à l'autre, rien n'est remis à zéro case par case.
+class PathService {
+public:
+    using Ticket = std::uint32_t;
+    static constexpr Ticket NO_TICKET = 0xFFFFFFFFu;
+
+    explicit PathService(std::size_t cacheCapacity = 512);
+
+    // La grille doit rester en vie jusqu'à la réponse
+    Ticket request(const NavGrid& grid, sf::Vector2f from, sf::Vector2f to);
+    PathStatus getStatus(Ticket ticket) const;
+    // Copie les points de passage (chemin lissé, sans le point de départ)
+    // puis libère le ticket ; faux si le chemin n'est pas prêt ou introuvable
+    bool take(Ticket ticket, std::vector<sf::Vector2f>& path);
+    // Libère un ticket dont on ne veut plus la réponse
+    void release(Ticket ticket);
+    // La grille va être détruite : ses demandes en attente échouent
+    void forget(const NavGrid& grid);
+
+    // Traite la file pendant au plus budget (au moins quelques noeuds)
+    void update(sf::Time budget);
+    void clearCache() { cache_.clear(); }
+
+    std::size_t getPendingCount() const { return queue_.size() + (searching_ ? 1 : 0); }
+    std::size_t getSearchCount() const { return searchCount_; }
+    std::size_t getCacheHitCount() const { return cacheHits_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Slot {
+        std::uint32_t serial;   // Change à chaque libération : les demandes périmées sont ignorées
+        PathStatus status;
+        bool used;
+        std::vector<sf::Vector2f> path;
+    };
+    struct Request {
+        const NavGrid* grid;
+        std::uint32_t start;
+        std::uint32_t goal;
+        Ticket ticket;
+        std::uint32_t serial;
+    };
+    struct OpenNode {
+        std::uint32_t f;
+        std::uint32_t cell;
+        bool operator>(const OpenNode& other) const { return f > other.f; }
+    };
+
+    bool isCurrent(const Request& request) const;
+    static std::uint64_t makeKey(const Request& request);
+    void complete(const Request& request, bool found, const std::vector<sf::Vector2f>& path);
+    void beginSearch(const Request& request);
+    // Vrai quand la recherche est terminée (trouvée ou non)
+    bool stepSearch(Clock::time_point deadline, bool& found);
+    void buildPath(std::vector<sf::Vector2f>& out);
+    std::uint32_t heuristic(std::uint32_t cell) const;
+
+    std::vector<Slot> slots_;
+    std::vector<Ticket> freeSlots_;
+    std::deque<Request> queue_;
+
+    std::size_t cacheCapacity_;
+    std::unordered_map<std::uint64_t, std::vector<sf::Vector2f>> cache_;
+
+    // Recherche en cours
+    bool searching_;
+    Request current_;
+    std::uint32_t generation_;          // stamp_[c] == generation_ : case vue par cette recherche
+    std::vector<std::uint32_t> stamp_;
+    std::vector<std::uint32_t> cost_;
+    std::vector<std::uint32_t> parent_;
+    std::vector<std::uint8_t> closed_;
+    std::vector<OpenNode> open_;        // Tas binaire (plus petit f en tête)
+    std::vector<std::uint32_t> cells_;  // Tampon de travail pour reconstruire le chemin
+    std::vector<sf::Vector2f> result_;
+
+    std::size_t searchCount_;
+    std::size_t cacheHits_;
+};
@@ -0,0 +1,160 @@
+#include "SaveFile.hpp"
+#include "AllocTracker.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+    const std::uint8_t MAGIC[4] = { 'N', 'O', 'L', 'S' };
+    const std::size_t HEADER_SIZE = 14; // Signature, version, taille, somme de contrôle
+
+    void putU16(std::uint8_t* out, std::uint16_t value) {
+        out[0] = static_cast<std::uint8_t>(value);
+        out[1] = static_cast<std::uint8_t>(value >> 8);
+    }
+
+    void putU32(std::uint8_t* out, std::uint32_t value) {
+        for (int i = 0; i < 4; i++) out[i] = static_cast<std::uint8_t>(value >> (i * 8));
+    }
+
+    std::uint32_t getU32(const std::uint8_t* in) {
+        return in[0] | (in[1] << 8) | (in[2] << 16) | (static_cast<std::uint32_t>(in[3]) << 24);
+    }
+
+    // Données du fichier écrites sur le disque (pas seulement dans le cache du système)
+    bool syncFile(std::FILE* file) {
+        if (std::fflush(file) != 0) return false;
+#ifdef _WIN32
+        return _commit(_fileno(file)) == 0;
+#else
+        return fsync(fileno(file)) == 0;
+#endif
+    }
+}
+
+SaveFile::SaveFile(std::string path)
+    : path_(std::move(path))
+    , hasPending_(false)
+    , writing_(false)
+    , stop_(false)
+{
+    worker_ = std::thread(&SaveFile::workerLoop, this);
+}
+
+SaveFile::~SaveFile() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    worker_.join();
+}
+
+std::uint32_t SaveFile::checksum(const std::uint8_t* data, std::size_t size) {
+    // FNV-1a 32 bits
+    std::uint32_t hash = 2166136261u;
+    for (std::size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void SaveFile::save(const GameSnapshot& snapshot) {
+    AllocTracker::Scope scope(AllocTag::Save);
+    encodeSnapshot(snapshot, payload_);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // pending_ garde sa capacité : pas d'allocation une fois la taille atteinte
+        pending_.resize(HEADER_SIZE + payload_.size());
+        std::copy(MAGIC, MAGIC + 4, pending_.begin());
+        putU16(&pending_[4], VERSION);
+        putU32(&pending_[6], static_cast<std::uint32_t>(payload_.size()));
+        putU32(&pending_[10], checksum(payload_.data(), payload_.size()));
+        std::copy(payload_.begin(), payload_.end(), pending_.begin() + HEADER_SIZE);
+        hasPending_ = true;
+    }
+    wake_.notify_one();
+}
+
+bool SaveFile::load(GameSnapshot& snapshot) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_.wait(lock, [this] { return !hasPending_ && !writing_; });
+    }
+
+    std::ifstream file(path_, std::ios::binary);
+    if (!file) return false;
+    std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (data.size() < HEADER_SIZE || !std::equal(MAGIC, MAGIC + 4, data.begin())) {
+        std::cerr << "Sauvegarde invalide : " << path_ << "\n";
+        return false;
+    }
+    const std::uint16_t version = static_cast<std::uint16_t>(data[4] | (data[5] << 8));
+    if (version != VERSION) {
+        std::cerr << "Sauvegarde d'une version non prise en charge (" << version << ") : " << path_ << "\n";
+        return false;
+    }
+    const std::uint32_t size = getU32(&data[6]);
+    if (size != data.size() - HEADER_SIZE || getU32(&data[10]) != checksum(&data[HEADER_SIZE], size)) {
+        std::cerr << "Sauvegarde corrompue : " << path_ << "\n";
+        return false;
+    }
+
+    // Seul le format de la version courante est lu
+    if (!decodeSnapshot(&data[HEADER_SIZE], size, snapshot)) {
+        std::cerr << "Sauvegarde illisible : " << path_ << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool SaveFile::write(const std::vector<std::uint8_t>& data) const {
+    const std::string temp = path_ + ".tmp";
+    std::FILE* file = std::fopen(temp.c_str(), "wb");
+    if (!file) return false;
+    bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    // Sur le disque avant le renommage : un arrêt brutal juste après ne
+    // laisse pas une sauvegarde vide ou tronquée à la place de l'ancienne
+    written = written && syncFile(file);
+    if (std::fclose(file) != 0 || !written) return false;
+
+    // Le renommage remplace l'ancienne sauvegarde d'un coup
+    std::error_code error;
+    std::filesystem::rename(temp, path_, error);
+    return !error;
+}
+
+void SaveFile::workerLoop() {
+    AllocTracker::setThreadTag(AllocTag::Save);
+    std::vector<std::uint8_t> data;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return stop_ || hasPending_; });
+            if (stop_ && !hasPending_) return;
+            data.swap(pending_);
+            hasPending_ = false;
+            writing_ = true;
+        }
+
+        if (!write(data)) {
+            std::cerr << "Impossible d'écrire la sauvegarde : " << path_ << "\n";
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            writing_ = false;
+        }
+        idle_.notify_all();
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "GameSnapshot.hpp"
+
+// Fichier de sauvegarde : en-tête (signature, version, taille, somme de
+// contrôle) puis l'état encodé par encodeSnapshot().
+// save() encode tout de suite (quelques microsecondes) et confie l'écriture
+// à un thread de fond : fichier temporaire puis renommage, pour qu'une
+// sauvegarde interrompue ne remplace jamais la précédente. Si plusieurs
+// sauvegardes attendent, seule la dernière est écrite.
+class SaveFile {
+public:
+    explicit SaveFile(std::string path);
+    ~SaveFile();
+    SaveFile(const SaveFile&) = delete;
+    SaveFile& operator=(const SaveFile&) = delete;
+
+    void save(const GameSnapshot& snapshot);
+    // Attend la fin de l'écriture en cours, puis lit et vérifie le fichier
+    bool load(GameSnapshot& snapshot);
+
+    // 2 : NPCs désignés par zone et étiquette (1 : par indice, plus lue)
+    static constexpr std::uint16_t VERSION = 2;
+
+private:
+    void workerLoop();
+    bool write(const std::vector<std::uint8_t>& data) const;
+    static std::uint32_t checksum(const std::uint8_t* data, std::size_t size);
+
+    std::string path_;
+    std::vector<std::uint8_t> payload_;  // Thread principal
+
+    // Partagé avec le thread de fond (protégé par mutex_)
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::vector<std::uint8_t> pending_;
+    bool hasPending_;
+    bool writing_;
+    bool stop_;
+
+    std::thread worker_;
+};
@@ -0,0 +1,73 @@
+#include "Game.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+// Simulation sans fenêtre : rejoue des parties enregistrées (voir
+// InputSession, nolan --record) le plus vite possible. Sert à entraîner
+// le PGO et à mesurer la logique du jeu sans le rendu.
+//   nolan_sim [--repeat N] [--assets DOSSIER] session...
+// --assets : dossier qui contient assets/ (sinon le dossier courant) ; les
+// sessions et la sauvegarde de simulation restent relatives au dossier de lancement
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> paths;
+    std::string assetsPath;
+    int repeat = 1;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--assets") == 0 && i + 1 < argc) {
+            assetsPath = argv[++i];
+        }
+        else {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (paths.empty()) {
+        std::cerr << "Usage : nolan_sim [--repeat N] [--assets DOSSIER] session...\n";
+        return 2;
+    }
+
+    // Les chemins du jeu sont relatifs au dossier courant : on s'y place
+    // après avoir fixé ceux des sessions et de la sauvegarde
+    std::string savePath;
+    if (!assetsPath.empty()) {
+        for (std::string& path : paths) path = std::filesystem::absolute(path).string();
+        savePath = std::filesystem::absolute("nolan_sim.sav").string();
+
+        std::error_code error;
+        std::filesystem::current_path(assetsPath, error);
+        if (error) {
+            std::cerr << "Dossier des assets introuvable : " << assetsPath << "\n";
+            return 2;
+        }
+    }
+
+    int status = 0;
+    for (const std::string& path : paths) {
+        InputSession session;
+        if (!session.load(path)) {
+            status = 1;
+            continue;
+        }
+
+        for (int run = 0; run < repeat; run++) {
+            // Une partie neuve à chaque passage : la session part du menu
+            Game game(true, savePath);
+            const auto start = std::chrono::steady_clock::now();
+            for (const SessionFrame& frame : session.getFrames()) {
+                game.simulateFrame(frame);
+            }
+            const std::chrono::duration<double, std::milli> wall = std::chrono::steady_clock::now() - start;
+
+            const double perFrame = session.size() > 0 ? wall.count() * 1000.0 / static_cast<double>(session.size()) : 0.0;
+            std::cout << path << " : " << session.size() << " frames, "
+                      << session.getDuration().asSeconds() << " s de jeu en " << wall.count() << " ms ("
+                      << perFrame << " us/frame), zone finale " << game.getCurrentArea() << "\n";
+        }
+    }
+    return status;
+}
@@ -0,0 +1,110 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : cellSize_(cellSize)
+    , origin_(0, 0)
+    , cellCount_(0, 0)
+    , queryId_(0)
+{
+}
+
+void SpatialGrid::clear() {
+    origin_ = { 0, 0 };
+    cellCount_ = { 0, 0 };
+    cellStart_.clear();
+    items_.clear();
+    bounds_.clear();
+    stamp_.clear();
+    queryId_ = 0;
+}
+
+void SpatialGrid::build(const std::vector<sf::FloatRect>& bounds) {
+    clear();
+    bounds_ = bounds;
+    if (bounds_.empty()) return;
+
+    // Étendue de la grille
+    float minX = bounds_[0].position.x, minY = bounds_[0].position.y;
+    float maxX = minX + bounds_[0].size.x, maxY = minY + bounds_[0].size.y;
+    for (const auto& b : bounds_) {
+        minX = std::min(minX, b.position.x);
+        minY = std::min(minY, b.position.y);
+        maxX = std::max(maxX, b.position.x + b.size.x);
+        maxY = std::max(maxY, b.position.y + b.size.y);
+    }
+    origin_ = { static_cast<int>(std::floor(minX / cellSize_)), static_cast<int>(std::floor(minY / cellSize_)) };
+    cellCount_ = {
+        static_cast<int>(std::floor(maxX / cellSize_)) - origin_.x + 1,
+        static_cast<int>(std::floor(maxY / cellSize_)) - origin_.y + 1
+    };
+
+    // Deux passes : on compte, puis on range (tableaux compacts qui gardent
+    // leur capacité : plus d'allocation quand on reconstruit chaque frame)
+    const std::size_t cells = static_cast<std::size_t>(cellCount_.x) * cellCount_.y;
+    cellStart_.assign(cells + 1, 0);
+
+    for (const auto& b : bounds_) {
+        sf::IntRect range = getCellRange(b);
+        for (int y = range.position.y; y < range.position.y + range.size.y; y++)
+            for (int x = range.position.x; x < range.position.x + range.size.x; x++)
+                cellStart_[static_cast<std::size_t>(y) * cellCount_.x + x + 1]++;
+    }
+    for (std::size_t c = 0; c < cells; c++) {
+        cellStart_[c + 1] += cellStart_[c];
+    }
+
+    items_.resize(cellStart_[cells]);
+    fill_.assign(cellStart_.begin(), cellStart_.end() - 1);
+    for (std::uint32_t i = 0; i < bounds_.size(); i++) {
+        sf::IntRect range = getCellRange(bounds_[i]);
+        for (int y = range.position.y; y < range.position.y + range.size.y; y++)
+            for (int x = range.position.x; x < range.position.x + range.size.x; x++)
+                items_[fill_[static_cast<std::size_t>(y) * cellCount_.x + x]++] = i;
+    }
+
+    stamp_.assign(bounds_.size(), 0);
+}
+
+sf::IntRect SpatialGrid::getCellRange(const sf::FloatRect& area) const {
+    int x0 = static_cast<int>(std::floor(area.position.x / cellSize_)) - origin_.x;
+    int y0 = static_cast<int>(std::floor(area.position.y / cellSize_)) - origin_.y;
+    int x1 = static_cast<int>(std::floor((area.position.x + area.size.x) / cellSize_)) - origin_.x;
+    int y1 = static_cast<int>(std::floor((area.position.y + area.size.y) / cellSize_)) - origin_.y;
+
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, cellCount_.x - 1);
+    y1 = std::min(y1, cellCount_.y - 1);
+
+    if (x1 < x0 || y1 < y0) return sf::IntRect({ 0, 0 }, { 0, 0 });
+    return sf::IntRect({ x0, y0 }, { x1 - x0 + 1, y1 - y0 + 1 });
+}
+
+void SpatialGrid::query(const sf::FloatRect& area, std::vector<std::uint32_t>& out) const {
+    out.clear();
+    if (bounds_.empty()) return;
+
+    if (++queryId_ == 0) {
+        std::fill(stamp_.begin(), stamp_.end(), 0);
+        queryId_ = 1;
+    }
+
+    sf::IntRect range = getCellRange(area);
+    for (int y = range.position.y; y < range.position.y + range.size.y; y++) {
+        for (int x = range.position.x; x < range.position.x + range.size.x; x++) {
+            std::size_t cell = static_cast<std::size_t>(y) * cellCount_.x + x;
+            for (std::uint32_t k = cellStart_[cell]; k < cellStart_[cell + 1]; k++) {
+                std::uint32_t i = items_[k];
+                if (stamp_[i] == queryId_) continue;
+                stamp_[i] = queryId_;
+                if (bounds_[i].findIntersection(area)) {
+                    out.push_back(i);
+                }
+            }
+        }
+    }
+
+    std::sort(out.begin(), out.end());
+}
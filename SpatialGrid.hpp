@@ -0,0 +1,41 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Grille spatiale uniforme (statique) : chaque case liste les objets qui la touchent.
+// On la construit une fois à partir des rectangles englobants, puis une requête
+// ne parcourt que les cases couvertes par le rectangle demandé.
+class SpatialGrid {
+public:
+    explicit SpatialGrid(float cellSize = 128.f);
+
+    // L'objet i a pour rectangle englobant bounds[i]
+    void build(const std::vector<sf::FloatRect>& bounds);
+    void clear();
+
+    // Indices des objets qui intersectent area, triés par ordre croissant
+    // (donc dans l'ordre d'ajout, ce qui garde l'ordre de dessin).
+    // Attention : utilise un marquage interne, une grille ne doit être
+    // interrogée que par un seul thread à la fois
+    void query(const sf::FloatRect& area, std::vector<std::uint32_t>& out) const;
+
+    // Cases couvertes par area (bornées à la grille), utile pour savoir si une requête a changé
+    sf::IntRect getCellRange(const sf::FloatRect& area) const;
+
+    float getCellSize() const { return cellSize_; }
+    std::size_t getItemCount() const { return bounds_.size(); }
+
+private:
+    float cellSize_;
+    sf::Vector2i origin_;                  // Première case (peut être négative)
+    sf::Vector2i cellCount_;
+    std::vector<std::uint32_t> cellStart_; // Début de chaque case dans items_ (+1 case de fin)
+    std::vector<std::uint32_t> items_;
+    std::vector<sf::FloatRect> bounds_;
+    std::vector<std::uint32_t> fill_;      // Tampon de build (prochaine place de chaque case)
+
+    // Marquage pour ne renvoyer qu'une fois un objet présent dans plusieurs cases
+    mutable std::vector<std::uint32_t> stamp_;
+    mutable std::uint32_t queryId_;
+};
@@ -0,0 +1,169 @@
+#include "StateHistory.hpp"
+#include "AllocTracker.hpp"
+#include <algorithm>
+#include <iostream>
+
+StateHistory::StateHistory(std::size_t maxFrames, std::size_t byteCapacity, std::size_t keyframeInterval)
+    : keyframeInterval_(std::max<std::size_t>(keyframeInterval, 1))
+    , data_(byteCapacity)
+    , entries_(std::max<std::size_t>(maxFrames, 1))
+    , head_(0)
+    , count_(0)
+    , writePos_(0)
+    , sinceKeyframe_(0)
+    , keyframes_(0)
+{
+}
+
+void StateHistory::clear() {
+    head_ = 0;
+    count_ = 0;
+    writePos_ = 0;
+    sinceKeyframe_ = 0;
+    keyframes_ = 0;
+    last_.clear();
+}
+
+bool StateHistory::reserve(std::size_t size, std::uint32_t& offset) const {
+    if (count_ == 0) {
+        offset = 0;
+        return size <= data_.size();
+    }
+
+    // Place libre : après le dernier enregistrement, puis au début du tampon
+    // jusqu'au plus ancien (sans jamais le toucher)
+    const std::uint32_t read = entry(0).offset;
+    if (writePos_ >= read) {
+        if (writePos_ + size <= data_.size()) {
+            offset = writePos_;
+            return true;
+        }
+        if (size < read) {
+            offset = 0;
+            return true;
+        }
+        return false;
+    }
+    if (writePos_ + size < read) {
+        offset = writePos_;
+        return true;
+    }
+    return false;
+}
+
+void StateHistory::dropOldest() {
+    // Une image clé et toutes les différences qui en dépendent
+    do {
+        if (entry(0).keyframe) keyframes_--;
+        head_ = (head_ + 1) % entries_.size();
+        count_--;
+    } while (count_ > 0 && !entry(0).keyframe);
+}
+
+bool StateHistory::push(const std::uint8_t* data, std::size_t size, bool keyframe) {
+    std::uint32_t offset = 0;
+    while (count_ == entries_.size() || !reserve(size, offset)) {
+        // Une différence ne doit pas faire disparaître sa propre image clé
+        if (count_ == 0 || (!keyframe && keyframes_ <= 1)) return false;
+        dropOldest();
+    }
+
+    std::copy(data, data + size, data_.begin() + offset);
+    entries_[(head_ + count_) % entries_.size()] = { offset, static_cast<std::uint32_t>(size), keyframe };
+    count_++;
+    if (keyframe) keyframes_++;
+    writePos_ = offset + static_cast<std::uint32_t>(size);
+    return true;
+}
+
+void StateHistory::record(const std::vector<std::uint8_t>& state) {
+    AllocTracker::Scope scope(AllocTag::History);
+    bool keyframe = count_ == 0 || sinceKeyframe_ + 1 >= keyframeInterval_ || state.size() != last_.size();
+
+    if (!keyframe) {
+        encodeDelta(state);
+        keyframe = !push(delta_.data(), delta_.size(), false);
+    }
+    if (keyframe && !push(state.data(), state.size(), true)) {
+        std::cerr << "Historique : état trop grand pour le tampon (" << state.size() << " octets)\n";
+        return;
+    }
+
+    last_ = state;
+    sinceKeyframe_ = keyframe ? 0 : sinceKeyframe_ + 1;
+}
+
+void StateHistory::truncate(std::size_t index) {
+    if (index + 1 >= count_) return;
+
+    while (count_ > index + 1) {
+        if (entry(count_ - 1).keyframe) keyframes_--;
+        count_--;
+    }
+    const Entry& lastEntry = entry(count_ - 1);
+    writePos_ = lastEntry.offset + lastEntry.size;
+
+    // La prochaine différence se calcule à partir de cette frame
+    get(index, last_);
+    sinceKeyframe_ = 0;
+    for (std::size_t i = index; !entry(i).keyframe; i--) sinceKeyframe_++;
+}
+
+bool StateHistory::get(std::size_t index, std::vector<std::uint8_t>& state) const {
+    if (index >= count_) return false;
+
+    // Dernière image clé, puis les différences jusqu'à la frame voulue
+    std::size_t key = index;
+    while (!entry(key).keyframe) key--;
+
+    const Entry& keyEntry = entry(key);
+    state.assign(data_.begin() + keyEntry.offset, data_.begin() + keyEntry.offset + keyEntry.size);
+    for (std::size_t i = key + 1; i <= index; i++) {
+        const Entry& delta = entry(i);
+        applyDelta(data_.data() + delta.offset, delta.size, state);
+    }
+    return true;
+}
+
+std::size_t StateHistory::getByteCount() const {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count_; i++) total += entry(i).size;
+    return total;
+}
+
+void StateHistory::encodeDelta(const std::vector<std::uint8_t>& state) {
+    // Suite de [octets identiques à sauter][nombre d'octets différents][XOR de ces octets]
+    delta_.clear();
+    const std::size_t n = state.size();
+    std::size_t i = 0;
+    while (i < n) {
+        std::size_t skip = 0;
+        while (i < n && skip < 255 && state[i] == last_[i]) {
+            i++;
+            skip++;
+        }
+        if (i == n) break;
+
+        std::size_t start = i;
+        while (i < n && i - start < 255 && state[i] != last_[i]) i++;
+
+        delta_.push_back(static_cast<std::uint8_t>(skip));
+        delta_.push_back(static_cast<std::uint8_t>(i - start));
+        for (std::size_t j = start; j < i; j++) {
+            delta_.push_back(static_cast<std::uint8_t>(state[j] ^ last_[j]));
+        }
+    }
+}
+
+void StateHistory::applyDelta(const std::uint8_t* delta, std::size_t size, std::vector<std::uint8_t>& state) {
+    std::size_t pos = 0;
+    std::size_t p = 0;
+    while (p + 2 <= size) {
+        pos += delta[p];
+        std::size_t count = delta[p + 1];
+        p += 2;
+        for (std::size_t j = 0; j < count && p < size && pos < state.size(); j++) {
+            state[pos++] ^= delta[p++];
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Historique des derniers états encodés (voir encodeSnapshot), un par frame,
+// pour revenir en arrière et avancer pas à pas pendant le débogage.
+// Tout tient dans deux tampons circulaires alloués une fois : les
+// enregistrements (octets) et leur index. Une image clé complète est gardée
+// toutes les keyframeInterval frames, les autres ne stockent que la
+// différence avec la précédente (XOR compressé par plages de zéros).
+// Quand la place manque, les plus anciennes frames sont oubliées, par
+// groupe entier à partir d'une image clé.
+class StateHistory {
+public:
+    StateHistory(std::size_t maxFrames, std::size_t byteCapacity, std::size_t keyframeInterval);
+
+    void clear();
+    // Ajoute la frame la plus récente
+    void record(const std::vector<std::uint8_t>& state);
+    // Oublie les frames après index (on reprend le jeu depuis celle-ci)
+    void truncate(std::size_t index);
+
+    // Frames gardées : 0 est la plus ancienne, size() - 1 la plus récente
+    std::size_t size() const { return count_; }
+    // Reconstruit l'état de la frame index
+    bool get(std::size_t index, std::vector<std::uint8_t>& state) const;
+
+    std::size_t getByteCount() const;
+
+private:
+    struct Entry {
+        std::uint32_t offset;
+        std::uint32_t size;
+        bool keyframe;
+    };
+
+    const Entry& entry(std::size_t index) const { return entries_[(head_ + index) % entries_.size()]; }
+    bool reserve(std::size_t size, std::uint32_t& offset) const;
+    void dropOldest();
+    bool push(const std::uint8_t* data, std::size_t size, bool keyframe);
+    void encodeDelta(const std::vector<std::uint8_t>& state);
+    static void applyDelta(const std::uint8_t* delta, std::size_t size, std::vector<std::uint8_t>& state);
+
+    std::size_t keyframeInterval_;
+    std::vector<std::uint8_t> data_;
+    std::vector<Entry> entries_;
+    std::size_t head_;              // Plus ancienne frame dans entries_
+    std::size_t count_;
+    std::uint32_t writePos_;        // Fin du dernier enregistrement dans data_
+    std::size_t sinceKeyframe_;
+    std::size_t keyframes_;
+
+    std::vector<std::uint8_t> last_;    // État de la frame la plus récente
+    std::vector<std::uint8_t> delta_;   // Tampon de travail
+};
@@ -0,0 +1,128 @@
+#include "StateStack.hpp"
+#include "DrawStats.hpp"
+#include <iostream>
+
+StateStack::StateStack()
+    : frozenValid_(false)
+{
+}
+
+void StateStack::setSize(sf::Vector2u size) {
+    if (!frozen_.resize(size)) {
+        std::cerr << "Impossible de créer la texture des états figés\n";
+        return;
+    }
+
+    const float w = static_cast<float>(size.x);
+    const float h = static_cast<float>(size.y);
+    frozenQuad_[0] = { { 0.f, 0.f }, sf::Color::White, { 0.f, 0.f } };
+    frozenQuad_[1] = { { w, 0.f }, sf::Color::White, { w, 0.f } };
+    frozenQuad_[2] = { { 0.f, h }, sf::Color::White, { 0.f, h } };
+    frozenQuad_[3] = { { 0.f, h }, sf::Color::White, { 0.f, h } };
+    frozenQuad_[4] = { { w, 0.f }, sf::Color::White, { w, 0.f } };
+    frozenQuad_[5] = { { w, h }, sf::Color::White, { w, h } };
+    frozenValid_ = false;
+}
+
+void StateStack::registerState(GameState id, std::unique_ptr<IGameState> state) {
+    states_[static_cast<std::size_t>(id)] = std::move(state);
+}
+
+IGameState& StateStack::get(GameState id) const {
+    return *states_[static_cast<std::size_t>(id)];
+}
+
+void StateStack::push(GameState id) {
+    stack_.push_back(id);
+    get(id).onEnter();
+    if (get(id).isOverlay()) freeze();
+}
+
+void StateStack::pop() {
+    if (stack_.empty()) return;
+    get(stack_.back()).onExit();
+    stack_.pop_back();
+    frozenValid_ = false;
+    if (!stack_.empty() && get(stack_.back()).isOverlay()) freeze();
+}
+
+void StateStack::replace(GameState id) {
+    if (stack_.empty()) {
+        push(id);
+        return;
+    }
+    get(stack_.back()).onExit();
+    stack_.back() = id;
+    get(id).onEnter();
+    frozenValid_ = false;
+    if (get(id).isOverlay()) freeze();
+}
+
+void StateStack::reset(GameState id) {
+    if (stack_.size() == 1 && stack_.back() == id) return;
+    while (!stack_.empty()) {
+        get(stack_.back()).onExit();
+        stack_.pop_back();
+    }
+    frozenValid_ = false;
+    push(id);
+}
+
+void StateStack::refreshFrozen() {
+    if (!stack_.empty() && get(stack_.back()).isOverlay()) freeze();
+}
+
+std::size_t StateStack::getFirstDrawn() const {
+    std::size_t first = stack_.size() - 1;
+    while (first > 0 && get(stack_[first]).isOverlay()) first--;
+    return first;
+}
+
+void StateStack::freeze() {
+    frozenValid_ = false;
+    if (stack_.size() < 2 || frozen_.getSize().x == 0) return;
+
+    // Les états sous le sommet, dessinés une seule fois
+    frozen_.setView(frozen_.getDefaultView());
+    for (std::size_t i = getFirstDrawn(); i + 1 < stack_.size(); i++) {
+        get(stack_[i]).render(frozen_);
+    }
+    frozen_.display();
+    frozenValid_ = true;
+}
+
+void StateStack::handleActions(const InputMap& input) {
+    if (!stack_.empty()) get(stack_.back()).handleActions(input);
+}
+
+void StateStack::handleClick(sf::Vector2f position) {
+    if (!stack_.empty()) get(stack_.back()).handleClick(position);
+}
+
+void StateStack::update(sf::Time dt) {
+    if (!stack_.empty()) get(stack_.back()).update(dt);
+}
+
+void StateStack::render(sf::RenderTarget& target) {
+    if (stack_.empty()) {
+        target.clear();
+        return;
+    }
+
+    IGameState& top = get(stack_.back());
+    if (!top.isOverlay()) {
+        top.render(target);
+        return;
+    }
+
+    if (frozenValid_) {
+        DrawStats::draw(target, frozenQuad_.data(), frozenQuad_.size(), sf::PrimitiveType::Triangles, sf::RenderStates(&frozen_.getTexture()));
+        top.render(target);
+        return;
+    }
+
+    // Pas d'image figée : on redessine toute la pile
+    for (std::size_t i = getFirstDrawn(); i < stack_.size(); i++) {
+        get(stack_[i]).render(target);
+    }
+}
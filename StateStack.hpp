@@ -0,0 +1,78 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <memory>
+#include <vector>
+#include "InputMap.hpp"
+
+enum class GameState { Menu, Playing, Paused, Credits, Count };
+
+// Un écran du jeu : ses entrées, sa mise à jour et son rendu.
+// Seul l'état au sommet de la pile reçoit les entrées et est mis à jour.
+class IGameState {
+public:
+    virtual ~IGameState() = default;
+
+    virtual void onEnter() {}
+    virtual void onExit() {}
+    // Actions de la frame (voir InputMap) et clics en coordonnées écran
+    virtual void handleActions(const InputMap& input) = 0;
+    virtual void handleClick(sf::Vector2f /*position*/) {}
+    virtual void update(sf::Time /*dt*/) {}
+    // Dessine tout l'écran, fond compris (un état superposé ne dessine que
+    // ce qui recouvre le dessous) ; la vue de l'écran est rétablie à la fin
+    virtual void render(sf::RenderTarget& target) = 0;
+
+    // Un état superposé (pause) est dessiné par-dessus une image figée des
+    // états du dessous, capturée quand il est empilé
+    virtual bool isOverlay() const { return false; }
+    // Faux si l'écran ne change qu'en réponse à un événement (menu, pause) :
+    // la boucle peut alors dormir au lieu de redessiner
+    virtual bool isAnimated() const { return true; }
+};
+
+// Pile d'états du jeu. Chaque état est créé une fois (registerState) et
+// garde ses données quand il quitte la pile ; push/pop/replace agissent
+// tout de suite, y compris depuis l'état du sommet.
+// Sous un état superposé, les états du dessous ne sont plus dessinés :
+// la pile garde leur dernière image dans une texture (un seul quad par frame).
+class StateStack {
+public:
+    StateStack();
+
+    // Taille de l'écran : crée la texture de l'image figée une fois pour toutes
+    void setSize(sf::Vector2u size);
+    void registerState(GameState id, std::unique_ptr<IGameState> state);
+
+    void push(GameState id);
+    void pop();
+    // Remplace l'état du sommet
+    void replace(GameState id);
+    // Vide la pile puis empile id (rien ne change si c'est déjà le seul état)
+    void reset(GameState id);
+    // Recapture l'image figée (le dessous a changé, par exemple la langue)
+    void refreshFrozen();
+
+    bool isEmpty() const { return stack_.empty(); }
+    GameState getCurrent() const { return stack_.empty() ? GameState::Menu : stack_.back(); }
+    bool isAnimated() const { return !stack_.empty() && get(stack_.back()).isAnimated(); }
+
+    void handleActions(const InputMap& input);
+    void handleClick(sf::Vector2f position);
+    void update(sf::Time dt);
+    void render(sf::RenderTarget& target);
+
+private:
+    IGameState& get(GameState id) const;
+    // Premier état dessiné directement : le sommet, ou l'état sous la pile
+    // de superpositions si l'image figée n'est pas disponible
+    std::size_t getFirstDrawn() const;
+    void freeze();
+
+    std::array<std::unique_ptr<IGameState>, static_cast<std::size_t>(GameState::Count)> states_;
+    std::vector<GameState> stack_;
+
+    sf::RenderTexture frozen_;
+    bool frozenValid_;                      // frozen_ montre les états sous le sommet
+    std::array<sf::Vertex, 6> frozenQuad_;
+};
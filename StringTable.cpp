@@ -0,0 +1,113 @@
+#include "StringTable.hpp"
+#include <fstream>
+#include <iostream>
+
+namespace {
+    std::string_view trim(std::string_view s) {
+        const char* spaces = " \t\r";
+        std::size_t first = s.find_first_not_of(spaces);
+        if (first == std::string_view::npos) return {};
+        std::size_t last = s.find_last_not_of(spaces);
+        return s.substr(first, last - first + 1);
+    }
+}
+
+StringTable::StringTable()
+    : locale_(Locale::FR)
+{
+}
+
+void StringTable::clear() {
+    ids_.clear();
+    keys_.clear();
+    for (std::size_t l = 0; l < LOCALE_COUNT; l++) {
+        pending_[l].clear();
+        hasPending_[l].clear();
+        texts_[l].clear();
+    }
+}
+
+StringId StringTable::getOrAdd(std::string_view key) {
+    auto [it, added] = ids_.try_emplace(std::string(key), static_cast<StringId>(keys_.size()));
+    if (added) {
+        keys_.push_back(it->first);
+        for (std::size_t l = 0; l < LOCALE_COUNT; l++) {
+            pending_[l].emplace_back();
+            hasPending_[l].push_back(false);
+        }
+    }
+    return it->second;
+}
+
+void StringTable::addKeys(const std::vector<std::string>& keys) {
+    for (const std::string& key : keys) {
+        getOrAdd(key);
+    }
+}
+
+bool StringTable::loadCatalog(Locale locale, const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Impossible de charger le catalogue : " << path << "\n";
+        return false;
+    }
+
+    const std::size_t l = static_cast<std::size_t>(locale);
+    std::string line;
+    int lineNumber = 0;
+    bool ok = true;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        std::string_view text = trim(line);
+        if (text.empty() || text[0] == '#') continue;
+
+        std::size_t equal = text.find('=');
+        if (equal == std::string_view::npos) {
+            std::cerr << path << ":" << lineNumber << " : '=' manquant\n";
+            ok = false;
+            continue;
+        }
+        StringId id = getOrAdd(trim(text.substr(0, equal)));
+        pending_[l][id] = std::string(trim(text.substr(equal + 1)));
+        hasPending_[l][id] = true;
+    }
+    return ok;
+}
+
+StringId StringTable::intern(std::string_view key, std::string_view baseText) {
+    StringId id = getOrAdd(key);
+    if (!hasPending_[0][id]) {
+        pending_[0][id] = std::string(baseText);
+        hasPending_[0][id] = true;
+    }
+    return id;
+}
+
+void StringTable::compile() {
+    for (std::size_t l = 0; l < LOCALE_COUNT; l++) {
+        std::size_t bytes = 0;
+        for (StringId id = 0; id < keys_.size(); id++) {
+            bytes += (hasPending_[l][id] ? pending_[l][id] : pending_[0][id]).size();
+        }
+
+        texts_[l].clear();
+        texts_[l].reserve(keys_.size(), bytes);
+        std::size_t missing = 0;
+        for (StringId id = 0; id < keys_.size(); id++) {
+            if (!hasPending_[l][id]) missing++;
+            texts_[l].add(hasPending_[l][id] ? pending_[l][id] : pending_[0][id]);
+        }
+        if (missing > 0) {
+            std::cerr << missing << " texte(s) non traduit(s) pour la langue " << l << "\n";
+        }
+    }
+}
+
+StringId StringTable::getId(std::string_view key) const {
+    auto it = ids_.find(std::string(key));
+    return it != ids_.end() ? it->second : NO_STRING;
+}
+
+std::string_view StringTable::get(StringId id) const {
+    return texts_[static_cast<std::size_t>(locale_)].getLine(id);
+}
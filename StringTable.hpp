@@ -0,0 +1,67 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "DialogueStore.hpp"
+
+// Langues du jeu (la première est la langue de référence)
+enum class Locale : std::uint8_t { FR, EN };
+const std::size_t LOCALE_COUNT = 2;
+
+using StringId = std::uint32_t;
+
+// Table des textes traduits. Les catalogues sources (lignes "clé = texte")
+// sont lus au chargement, puis compile() range les textes de chaque langue
+// bout à bout, dans l'ordre des identifiants. Un identifiant est fixé dès
+// que sa clé est connue ; ensuite get() n'est qu'une lecture dans le
+// tableau de la langue courante : pas de recherche, pas d'allocation.
+// Un texte absent d'une langue reprend celui de la langue de référence.
+class StringTable {
+public:
+    static const StringId NO_STRING = 0xFFFFFFFF;
+
+    StringTable();
+
+    // Étape de chargement
+    bool loadCatalog(Locale locale, const std::string& path);
+    // Identifiant de la clé, créée au besoin avec son texte de référence
+    StringId intern(std::string_view key, std::string_view baseText);
+    void compile();
+    void clear();
+    // Reprend les clés d'une table précédente, dans le même ordre : elles
+    // gardent leur identifiant (rechargement des textes pendant le jeu)
+    void addKeys(const std::vector<std::string>& keys);
+    const std::vector<std::string>& getKeys() const { return keys_; }
+
+    // Recherche par clé (au chargement seulement), NO_STRING si inconnue
+    StringId getId(std::string_view key) const;
+
+    void setLocale(Locale locale) { locale_ = locale; }
+    Locale getLocale() const { return locale_; }
+
+    std::string_view get(StringId id) const;
+    std::size_t size() const { return keys_.size(); }
+
+    // Texte prêt pour sf::Text
+    sf::String getSf(StringId id) const {
+        std::string_view text = get(id);
+        return sf::String::fromUtf8(text.begin(), text.end());
+    }
+
+private:
+    StringId getOrAdd(std::string_view key);
+
+    std::unordered_map<std::string, StringId> ids_;
+    std::vector<std::string> keys_;
+
+    // Textes sources, par langue et par identifiant (relus par compile())
+    std::vector<std::string> pending_[LOCALE_COUNT];
+    std::vector<bool> hasPending_[LOCALE_COUNT];
+
+    // Table compilée : un buffer par langue, mêmes indices partout
+    DialogueStore texts_[LOCALE_COUNT];
+    Locale locale_;
+};
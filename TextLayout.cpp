@@ -0,0 +1,176 @@
+#include "TextLayout.hpp"
+#include "DrawStats.hpp"
+#include <algorithm>
+
+namespace {
+    // Mêmes valeurs que sf::Text, pour un rendu identique
+    const float ITALIC_SHEAR = 0.2094395f; // 12 degrés
+    const float GLYPH_PADDING = 1.f;
+    const std::size_t VERTICES_PER_GLYPH = 6;
+}
+
+TextLayout::TextLayout()
+    : font_(nullptr)
+    , characterSize_(0)
+    , color_(sf::Color::White)
+    , pageHeight_(0.f)
+{
+}
+
+void TextLayout::clear() {
+    vertices_.clear();
+    glyphLine_.clear();
+    pageStart_.clear();
+}
+
+void TextLayout::addGlyph(sf::Vector2f pos, const sf::Glyph& glyph, float shear) {
+    const float left = glyph.bounds.position.x - GLYPH_PADDING;
+    const float top = glyph.bounds.position.y - GLYPH_PADDING;
+    const float right = glyph.bounds.position.x + glyph.bounds.size.x + GLYPH_PADDING;
+    const float bottom = glyph.bounds.position.y + glyph.bounds.size.y + GLYPH_PADDING;
+
+    const float u1 = static_cast<float>(glyph.textureRect.position.x) - GLYPH_PADDING;
+    const float v1 = static_cast<float>(glyph.textureRect.position.y) - GLYPH_PADDING;
+    const float u2 = static_cast<float>(glyph.textureRect.position.x + glyph.textureRect.size.x) + GLYPH_PADDING;
+    const float v2 = static_cast<float>(glyph.textureRect.position.y + glyph.textureRect.size.y) + GLYPH_PADDING;
+
+    vertices_.push_back({ { pos.x + left - shear * top, pos.y + top }, color_, { u1, v1 } });
+    vertices_.push_back({ { pos.x + right - shear * top, pos.y + top }, color_, { u2, v1 } });
+    vertices_.push_back({ { pos.x + left - shear * bottom, pos.y + bottom }, color_, { u1, v2 } });
+    vertices_.push_back({ { pos.x + left - shear * bottom, pos.y + bottom }, color_, { u1, v2 } });
+    vertices_.push_back({ { pos.x + right - shear * top, pos.y + top }, color_, { u2, v1 } });
+    vertices_.push_back({ { pos.x + right - shear * bottom, pos.y + bottom }, color_, { u2, v2 } });
+}
+
+void TextLayout::build(const sf::Font& font, const sf::String& text, unsigned characterSize,
+    float maxWidth, std::size_t linesPerPage, sf::Color color, bool italic,
+    bool centered, float lineSpacing)
+{
+    clear();
+    font_ = &font;
+    characterSize_ = characterSize;
+    color_ = color;
+
+    const float shear = italic ? ITALIC_SHEAR : 0.f;
+    const float spaceWidth = font.getGlyph(U' ', characterSize, false).advance;
+    if (lineSpacing <= 0.f) lineSpacing = font.getLineSpacing(characterSize);
+    linesPerPage = std::max<std::size_t>(linesPerPage, 1);
+    pageHeight_ = lineSpacing * static_cast<float>(linesPerPage);
+
+    float x = 0.f;
+    float y = static_cast<float>(characterSize);
+    std::uint32_t line = 0;
+    std::size_t wordStart = 0;  // Premier glyphe du mot en cours
+    float wordX = 0.f;          // Abscisse du début du mot en cours
+    char32_t previous = 0;
+
+    for (std::size_t i = 0; i < text.getSize(); i++) {
+        char32_t c = text[i];
+        if (c == U'\r') continue;
+
+        x += font.getKerning(previous, c, characterSize);
+        previous = c;
+
+        if (c == U' ' || c == U'\t' || c == U'\n') {
+            if (c == U'\n') {
+                x = 0.f;
+                y += lineSpacing;
+                line++;
+            }
+            else {
+                x += c == U'\t' ? spaceWidth * 4.f : spaceWidth;
+            }
+            wordStart = glyphLine_.size();
+            wordX = x;
+            continue;
+        }
+
+        const sf::Glyph& glyph = font.getGlyph(c, characterSize, false);
+
+        // Le mot dépasse : il passe entier à la ligne suivante
+        // (sauf s'il est seul sur sa ligne, on le coupe alors où il dépasse)
+        if (x + glyph.advance > maxWidth && x > 0.f) {
+            float shift = wordX > 0.f ? wordX : x;
+            if (wordX <= 0.f) {
+                wordStart = glyphLine_.size();
+            }
+            for (std::size_t g = wordStart; g < glyphLine_.size(); g++) {
+                glyphLine_[g]++;
+                for (std::size_t v = g * VERTICES_PER_GLYPH; v < (g + 1) * VERTICES_PER_GLYPH; v++) {
+                    vertices_[v].position.x -= shift;
+                    vertices_[v].position.y += lineSpacing;
+                }
+            }
+            x -= shift;
+            y += lineSpacing;
+            line++;
+            wordX = 0.f;
+        }
+
+        addGlyph({ x, y }, glyph, shear);
+        glyphLine_.push_back(line);
+        x += glyph.advance;
+    }
+
+    const std::size_t glyphs = glyphLine_.size();
+
+    // Centrage : chaque ligne est décalée d'après l'étendue de ses glyphes
+    if (centered) {
+        for (std::size_t start = 0, end = 0; start < glyphs; start = end) {
+            float left = vertices_[start * VERTICES_PER_GLYPH].position.x;
+            float right = left;
+            for (end = start; end < glyphs && glyphLine_[end] == glyphLine_[start]; end++) {
+                for (std::size_t v = end * VERTICES_PER_GLYPH; v < (end + 1) * VERTICES_PER_GLYPH; v++) {
+                    left = std::min(left, vertices_[v].position.x);
+                    right = std::max(right, vertices_[v].position.x);
+                }
+            }
+            const float shift = (maxWidth - left - right) / 2.f;
+            for (std::size_t v = start * VERTICES_PER_GLYPH; v < end * VERTICES_PER_GLYPH; v++) {
+                vertices_[v].position.x += shift;
+            }
+        }
+    }
+
+    // Pages : les glyphes sont rangés dans l'ordre des lignes
+    const std::size_t pages = glyphs == 0 ? 1 : glyphLine_.back() / linesPerPage + 1;
+    pageStart_.assign(pages + 1, static_cast<std::uint32_t>(glyphs));
+    pageStart_[0] = 0;
+    for (std::size_t page = 1, g = 0; page < pages; page++) {
+        while (g < glyphs && glyphLine_[g] / linesPerPage < page) g++;
+        pageStart_[page] = static_cast<std::uint32_t>(g);
+    }
+}
+
+std::size_t TextLayout::getGlyphCount(std::size_t page) const {
+    if (page >= getPageCount()) return 0;
+    return pageStart_[page + 1] - pageStart_[page];
+}
+
+void TextLayout::draw(sf::RenderTarget& target, sf::Vector2f position, std::size_t page, std::size_t glyphCount) const {
+    if (!font_ || page >= getPageCount()) return;
+    glyphCount = std::min(glyphCount, getGlyphCount(page));
+    if (glyphCount == 0) return;
+
+    // Les pages sont empilées verticalement : on remonte jusqu'à la page affichée
+    sf::RenderStates states;
+    states.transform.translate({ position.x, position.y - pageHeight_ * static_cast<float>(page) });
+    states.texture = &font_->getTexture(characterSize_);
+
+    DrawStats::draw(target, &vertices_[pageStart_[page] * VERTICES_PER_GLYPH], glyphCount * VERTICES_PER_GLYPH,
+        sf::PrimitiveType::Triangles, states);
+}
+
+void TextLayout::drawPages(sf::RenderTarget& target, sf::Vector2f position, std::size_t first, std::size_t last) const {
+    if (!font_ || first > last || first >= getPageCount()) return;
+    last = std::min(last, getPageCount() - 1);
+    const std::size_t glyphCount = pageStart_[last + 1] - pageStart_[first];
+    if (glyphCount == 0) return;
+
+    sf::RenderStates states;
+    states.transform.translate(position);
+    states.texture = &font_->getTexture(characterSize_);
+
+    DrawStats::draw(target, &vertices_[pageStart_[first] * VERTICES_PER_GLYPH], glyphCount * VERTICES_PER_GLYPH,
+        sf::PrimitiveType::Triangles, states);
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Texte mis en page une seule fois : les glyphes sont placés dans un
+// tableau de sommets, avec retour à la ligne automatique entre les mots
+// et découpage en pages. L'affichage ne dessine que les premiers glyphes
+// d'une page (effet machine à écrire) sans jamais refaire la mise en page.
+class TextLayout {
+public:
+    TextLayout();
+
+    // centered : chaque ligne est centrée dans maxWidth
+    // lineSpacing : interligne imposé (0 : celui de la police)
+    void build(const sf::Font& font, const sf::String& text, unsigned characterSize,
+        float maxWidth, std::size_t linesPerPage, sf::Color color, bool italic,
+        bool centered = false, float lineSpacing = 0.f);
+    void clear();
+
+    std::size_t getPageCount() const { return pageStart_.empty() ? 0 : pageStart_.size() - 1; }
+    float getPageHeight() const { return pageHeight_; }
+    // Nombre de glyphes visibles de la page (les espaces n'en ont pas)
+    std::size_t getGlyphCount(std::size_t page) const;
+
+    // Dessine les glyphCount premiers glyphes de la page
+    void draw(sf::RenderTarget& target, sf::Vector2f position, std::size_t page, std::size_t glyphCount) const;
+    // Dessine les pages first à last en un seul appel, à leur place dans le texte
+    // (texte qui défile : seules les pages visibles sont envoyées)
+    void drawPages(sf::RenderTarget& target, sf::Vector2f position, std::size_t first, std::size_t last) const;
+
+private:
+    void addGlyph(sf::Vector2f pos, const sf::Glyph& glyph, float shear);
+
+    const sf::Font* font_;
+    unsigned characterSize_;
+    sf::Color color_;
+    float pageHeight_;
+
+    std::vector<sf::Vertex> vertices_;      // 6 sommets par glyphe
+    std::vector<std::uint32_t> glyphLine_;  // Ligne de chaque glyphe
+    std::vector<std::uint32_t> pageStart_;  // Premier glyphe de chaque page, + le total
+};
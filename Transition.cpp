@@ -0,0 +1,137 @@
+#include "Transition.hpp"
+#include "DrawStats.hpp"
+#include <algorithm>
+#include <iostream>
+
+Transition::Transition()
+    : phase_(Phase::Idle)
+    , effect_(TransitionEffect::Fade)
+    , easing_(Easing::SmoothStep)
+    , duration_(0.4f)
+    , progress_(0.f)
+    , captured_(false)
+    , size_(0.f, 0.f)
+{
+}
+
+void Transition::setSize(sf::Vector2u size) {
+    size_ = { static_cast<float>(size.x), static_cast<float>(size.y) };
+    if (!snapshot_.resize(size)) {
+        std::cerr << "Impossible de créer la texture de transition\n";
+    }
+
+    // Le quad de la capture ne change jamais de forme, seulement d'opacité
+    setQuad(snapshotQuad_, sf::FloatRect({ 0.f, 0.f }, size_), sf::FloatRect({ 0.f, 0.f }, size_));
+    updateGeometry();
+}
+
+void Transition::start(TransitionEffect effect, float duration, Easing easing) {
+    effect_ = effect;
+    easing_ = easing;
+    duration_ = std::max(duration, 0.001f);
+    progress_ = 0.f;
+    captured_ = false;
+    phase_ = Phase::Out;
+    updateGeometry();
+}
+
+void Transition::reset() {
+    phase_ = Phase::Idle;
+    progress_ = 0.f;
+    captured_ = false;
+    updateGeometry();
+}
+
+bool Transition::update(sf::Time dt, bool targetReady) {
+    const float step = dt.asSeconds() / duration_;
+
+    if (phase_ == Phase::Out) {
+        // Crossfade : on change de zone d'un coup, dès que l'ancienne est
+        // capturée et que la nouvelle est chargée (sinon elle apparaîtrait vide)
+        if (effect_ == TransitionEffect::Crossfade) {
+            if (!captured_ || !targetReady) return false;
+            progress_ = 1.f;
+        }
+        else {
+            progress_ = std::min(progress_ + step, 1.f);
+            if (progress_ < 1.f) {
+                updateGeometry();
+                return false;
+            }
+        }
+        phase_ = Phase::In;
+        updateGeometry();
+        return true;
+    }
+
+    if (phase_ == Phase::In) {
+        // On ne découvre la nouvelle zone que quand elle est prête
+        if (!targetReady) return false;
+        progress_ = std::max(progress_ - step, 0.f);
+        if (progress_ <= 0.f) {
+            phase_ = Phase::Idle;
+        }
+        updateGeometry();
+    }
+    return false;
+}
+
+void Transition::capture(const sf::RenderWindow& window) {
+    if (window.getSize() != snapshot_.getSize()) return;
+    snapshot_.update(window);
+    captured_ = true;
+}
+
+float Transition::ease(Easing easing, float t) {
+    t = std::clamp(t, 0.f, 1.f);
+    switch (easing) {
+    case Easing::SmoothStep: return t * t * (3.f - 2.f * t);
+    case Easing::EaseIn:     return t * t * t;
+    case Easing::EaseOut:    return 1.f - (1.f - t) * (1.f - t) * (1.f - t);
+    default:                 return t;
+    }
+}
+
+void Transition::setQuad(std::array<sf::Vertex, 6>& quad, sf::FloatRect rect, sf::FloatRect texRect) {
+    const sf::Vector2f a = rect.position;
+    const sf::Vector2f b = rect.position + rect.size;
+    const sf::Vector2f ta = texRect.position;
+    const sf::Vector2f tb = texRect.position + texRect.size;
+
+    quad[0].position = { a.x, a.y }; quad[0].texCoords = { ta.x, ta.y };
+    quad[1].position = { b.x, a.y }; quad[1].texCoords = { tb.x, ta.y };
+    quad[2].position = { a.x, b.y }; quad[2].texCoords = { ta.x, tb.y };
+    quad[3].position = { a.x, b.y }; quad[3].texCoords = { ta.x, tb.y };
+    quad[4].position = { b.x, a.y }; quad[4].texCoords = { tb.x, ta.y };
+    quad[5].position = { b.x, b.y }; quad[5].texCoords = { tb.x, tb.y };
+}
+
+void Transition::updateGeometry() {
+    const float amount = ease(easing_, progress_);
+    const auto alpha = static_cast<std::uint8_t>(amount * 255.f);
+
+    sf::FloatRect cover({ 0.f, 0.f }, size_);
+    if (effect_ == TransitionEffect::Wipe) {
+        // Le rideau entre par la gauche et ressort par la droite
+        const float width = size_.x * amount;
+        cover.position.x = phase_ == Phase::In ? size_.x - width : 0.f;
+        cover.size.x = width;
+    }
+    setQuad(cover_, cover, {});
+
+    const sf::Color coverColor(0, 0, 0, effect_ == TransitionEffect::Fade ? alpha : 255);
+    for (auto& vertex : cover_) vertex.color = coverColor;
+    for (auto& vertex : snapshotQuad_) vertex.color = sf::Color(255, 255, 255, alpha);
+}
+
+void Transition::draw(sf::RenderTarget& target) const {
+    if (phase_ == Phase::Idle) return;
+
+    if (effect_ == TransitionEffect::Crossfade) {
+        if (phase_ == Phase::In) {
+            DrawStats::draw(target, snapshotQuad_.data(), snapshotQuad_.size(), sf::PrimitiveType::Triangles, sf::RenderStates(&snapshot_));
+        }
+        return;
+    }
+    DrawStats::draw(target, cover_.data(), cover_.size(), sf::PrimitiveType::Triangles);
+}
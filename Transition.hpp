@@ -0,0 +1,66 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+
+// Effet de passage d'une zone à l'autre
+enum class TransitionEffect { Fade, Wipe, Crossfade };
+// Courbe appliquée à l'avancement (0 à 1) de l'effet
+enum class Easing { Linear, SmoothStep, EaseIn, EaseOut };
+
+// Transition d'écran en deux temps : l'ancienne zone est recouverte (sortie),
+// on change de zone, puis la nouvelle est découverte (entrée).
+// - Fade : fondu au noir
+// - Wipe : rideau noir qui balaie l'écran de gauche à droite
+// - Crossfade : fondu enchaîné entre une capture de l'ancienne zone et la nouvelle
+// La géométrie (deux quads) est gardée d'une frame à l'autre : rien n'est alloué
+// pendant la transition. La sortie peut attendre que la zone d'arrivée soit
+// chargée, et l'entrée ne commence que quand elle est prête.
+class Transition {
+public:
+    Transition();
+
+    // Taille de l'écran : crée la texture de capture une fois pour toutes
+    void setSize(sf::Vector2u size);
+
+    void start(TransitionEffect effect, float duration, Easing easing = Easing::SmoothStep);
+    void reset();
+
+    // targetReady : la zone d'arrivée est chargée (préchargement pendant la sortie,
+    // chunks visibles pendant l'entrée). Renvoie vrai une seule fois, au moment
+    // de changer de zone (l'écran est alors entièrement recouvert)
+    bool update(sf::Time dt, bool targetReady);
+
+    bool isActive() const { return phase_ != Phase::Idle; }
+    bool isRevealing() const { return phase_ == Phase::In; }
+    // Part de l'écran recouverte (0 à 1, courbe appliquée)
+    float getCover() const { return phase_ == Phase::Idle ? 0.f : ease(easing_, progress_); }
+
+    // Crossfade : la frame courante doit être capturée avant draw()
+    bool needsCapture() const { return phase_ == Phase::Out && effect_ == TransitionEffect::Crossfade; }
+    void capture(const sf::RenderWindow& window);
+    // Sans rendu (simulation) : la sortie continue sans capture
+    void skipCapture() { captured_ = true; }
+
+    // À dessiner par-dessus la scène, en coordonnées écran
+    void draw(sf::RenderTarget& target) const;
+
+    static float ease(Easing easing, float t);
+
+private:
+    enum class Phase { Idle, Out, In };
+
+    void updateGeometry();
+    static void setQuad(std::array<sf::Vertex, 6>& quad, sf::FloatRect rect, sf::FloatRect texRect);
+
+    Phase phase_;
+    TransitionEffect effect_;
+    Easing easing_;
+    float duration_;    // Durée de chaque moitié (sortie, entrée), en secondes
+    float progress_;    // 0 : scène visible, 1 : scène recouverte
+    bool captured_;
+
+    sf::Vector2f size_;
+    sf::Texture snapshot_;
+    std::array<sf::Vertex, 6> cover_;       // Rideau noir (Fade, Wipe)
+    std::array<sf::Vertex, 6> snapshotQuad_; // Capture de l'ancienne zone (Crossfade)
+};
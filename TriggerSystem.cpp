@@ -0,0 +1,104 @@
+#include "TriggerSystem.hpp"
+#include <algorithm>
+
+TriggerSystem::TriggerSystem()
+    : current_(nullptr)
+{
+}
+
+std::size_t TriggerSystem::add(const TriggerZone& zone) {
+    zones_.push_back(zone);
+    startEnabled_.push_back(zone.enabled);
+    return zones_.size() - 1;
+}
+
+void TriggerSystem::clear() {
+    zones_.clear();
+    startEnabled_.clear();
+    areas_.clear();
+    current_ = nullptr;
+    inside_.clear();
+}
+
+void TriggerSystem::build() {
+    areas_.clear();
+    for (std::uint32_t id = 0; id < zones_.size(); id++) {
+        areas_[zones_[id].area].ids.push_back(id);
+    }
+
+    for (auto& [name, area] : areas_) {
+        std::vector<sf::FloatRect> bounds;
+        for (std::uint32_t id : area.ids) {
+            bounds.push_back(zones_[id].bounds);
+        }
+        area.index.build(bounds);
+    }
+    current_ = nullptr;
+    inside_.clear();
+}
+
+void TriggerSystem::subscribe(TriggerType type, TriggerEvent event, Handler handler) {
+    handlers_[static_cast<int>(type) * EVENT_COUNT + static_cast<int>(event)].push_back(std::move(handler));
+}
+
+void TriggerSystem::setEnabled(std::size_t id, bool enabled) {
+    zones_[id].enabled = enabled;
+}
+
+void TriggerSystem::reset() {
+    for (std::size_t id = 0; id < zones_.size(); id++) {
+        zones_[id].enabled = startEnabled_[id];
+    }
+    inside_.clear();
+}
+
+void TriggerSystem::setArea(const std::string& area, const sf::FloatRect& playerBounds) {
+    auto it = areas_.find(area);
+    current_ = it != areas_.end() ? &it->second : nullptr;
+    findInside(playerBounds, inside_);
+}
+
+void TriggerSystem::findInside(const sf::FloatRect& playerBounds, std::vector<std::uint32_t>& out) {
+    out.clear();
+    if (!current_) return;
+
+    current_->index.query(playerBounds, candidates_);
+    for (std::uint32_t local : candidates_) {
+        std::uint32_t id = current_->ids[local];
+        if (zones_[id].enabled) out.push_back(id);
+    }
+    // Les indices locaux sont triés et ids est croissant : out est trié
+}
+
+void TriggerSystem::update(const sf::FloatRect& playerBounds) {
+    findInside(playerBounds, nowInside_);
+
+    // Comparaison des deux listes triées : entrée, présence, sortie
+    events_.clear();
+    std::size_t i = 0, j = 0;
+    while (i < inside_.size() || j < nowInside_.size()) {
+        if (j == nowInside_.size() || (i < inside_.size() && inside_[i] < nowInside_[j])) {
+            events_.push_back({ inside_[i++], TriggerEvent::Exit });
+        }
+        else if (i == inside_.size() || nowInside_[j] < inside_[i]) {
+            events_.push_back({ nowInside_[j++], TriggerEvent::Enter });
+        }
+        else {
+            events_.push_back({ nowInside_[j++], TriggerEvent::Stay });
+            i++;
+        }
+    }
+    inside_.swap(nowInside_);
+
+    // Envoi après la mise à jour de l'état : un abonné peut activer/désactiver des triggers
+    for (const auto& [id, event] : events_) {
+        dispatch(id, event);
+    }
+}
+
+void TriggerSystem::dispatch(std::uint32_t id, TriggerEvent event) {
+    const auto& handlers = handlers_[static_cast<int>(zones_[id].type) * EVENT_COUNT + static_cast<int>(event)];
+    for (const auto& handler : handlers) {
+        handler(zones_[id]);
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "SpatialGrid.hpp"
+#include "Transition.hpp"
+
+// Ce que fait une zone quand le joueur y entre
+enum class TriggerType { Transition, Cutscene };
+// Événements envoyés par le système
+enum class TriggerEvent { Enter, Stay, Exit };
+
+struct TriggerZone {
+    sf::FloatRect bounds;
+    std::string area;       // Zone du monde où se trouve le trigger
+    TriggerType type;
+    std::string target;     // Zone d'arrivée (Transition) ou texte affiché (Cutscene)
+    sf::Vector2f spawn;     // Position du joueur à l'arrivée (Transition)
+    bool enabled = true;    // Un trigger désactivé est ignoré
+    TransitionEffect effect = TransitionEffect::Fade; // Effet du passage (Transition)
+};
+
+// Triggers rangés par zone avec un index spatial : chaque frame, seuls ceux
+// qui touchent le joueur sont testés. Les changements (entrée, présence,
+// sortie) sont envoyés aux fonctions abonnées au type de trigger.
+class TriggerSystem {
+public:
+    using Handler = std::function<void(const TriggerZone&)>;
+
+    TriggerSystem();
+
+    std::size_t add(const TriggerZone& zone);
+    void clear();
+    // À appeler après les add() : construit les index de chaque zone
+    void build();
+
+    void subscribe(TriggerType type, TriggerEvent event, Handler handler);
+
+    void setEnabled(std::size_t id, bool enabled);
+    // Remet les triggers dans leur état de départ (activés ou non)
+    void reset();
+
+    // Changement de zone : les triggers où le joueur apparaît sont marqués
+    // comme déjà occupés, sans envoyer d'événement (pas d'aller-retour immédiat)
+    void setArea(const std::string& area, const sf::FloatRect& playerBounds);
+    // Teste les triggers proches du joueur et envoie les événements
+    void update(const sf::FloatRect& playerBounds);
+
+    const TriggerZone& get(std::size_t id) const { return zones_[id]; }
+    std::size_t size() const { return zones_.size(); }
+
+private:
+    struct AreaTriggers {
+        std::vector<std::uint32_t> ids;
+        SpatialGrid index;
+    };
+
+    void findInside(const sf::FloatRect& playerBounds, std::vector<std::uint32_t>& out);
+    void dispatch(std::uint32_t id, TriggerEvent event);
+
+    std::vector<TriggerZone> zones_;
+    std::vector<bool> startEnabled_;
+    std::unordered_map<std::string, AreaTriggers> areas_;
+    const AreaTriggers* current_;
+
+    // Triggers occupés par le joueur (triés), et tampons réutilisés
+    std::vector<std::uint32_t> inside_;
+    std::vector<std::uint32_t> nowInside_;
+    std::vector<std::uint32_t> candidates_;
+    std::vector<std::pair<std::uint32_t, TriggerEvent>> events_;
+
+    static const int TYPE_COUNT = 2;
+    static const int EVENT_COUNT = 3;
+    std::vector<Handler> handlers_[TYPE_COUNT * EVENT_COUNT];
+};
@@ -0,0 +1,211 @@
+#include "World.hpp"
+#include "DrawStats.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const std::size_t CIRCLE_POINTS = 32;
+    // Les petits cercles (yeux) se contentent d'un point sur quatre
+    const float SMALL_RADIUS = 3.f;
+    const std::size_t SMALL_CIRCLE_STEP = 4;
+
+    const sf::Color SKIN_COLOR(210, 180, 140);
+    const sf::Color SHOULDER_COLOR(255, 192, 203);
+}
+
+World::World()
+    : next_(0)
+{
+    const float pi = 3.14159265f;
+    for (std::size_t i = 0; i < CIRCLE_POINTS; i++) {
+        float angle = static_cast<float>(i) * 2.f * pi / CIRCLE_POINTS - pi / 2.f;
+        circle_.push_back({ std::cos(angle), std::sin(angle) });
+    }
+}
+
+Entity World::create() {
+    return next_++;
+}
+
+void World::destroy(Entity entity) {
+    transforms.remove(entity);
+    bounds.remove(entity);
+    sprites.remove(entity);
+    bobs.remove(entity);
+    dialogues.remove(entity);
+    interactables.remove(entity);
+    colliders.remove(entity);
+    controllers.remove(entity);
+    agents.remove(entity);
+}
+
+void World::clear() {
+    transforms.clear();
+    bounds.clear();
+    sprites.clear();
+    bobs.clear();
+    dialogues.clear();
+    interactables.clear();
+    colliders.clear();
+    controllers.clear();
+    agents.clear();
+    next_ = 0;
+}
+
+sf::FloatRect World::getBounds(Entity entity) const {
+    const Transform& transform = transforms.get(entity);
+    return sf::FloatRect(transform.position + transform.offset, bounds.get(entity).size);
+}
+
+void World::setPosition(Entity entity, sf::Vector2f position) {
+    Transform& transform = transforms.get(entity);
+    transform.position = position;
+    transform.offset = { 0.f, 0.f };
+}
+
+void World::updateControllers(sf::Time dt, const MoveInput& input) {
+    for (std::size_t i = 0; i < controllers.size(); i++) {
+        Controller& controller = controllers[i];
+        const Entity entity = controllers.getEntity(i);
+        const float step = controller.speed * dt.asSeconds();
+
+        // La dernière touche testée donne la direction (droite avant gauche, avant bas, avant haut)
+        sf::Vector2f movement{ 0.f, 0.f };
+        if (input.up) { movement.y -= step; controller.direction = Direction::Up; }
+        if (input.down) { movement.y += step; controller.direction = Direction::Down; }
+        if (input.left) { movement.x -= step; controller.direction = Direction::Left; }
+        if (input.right) { movement.x += step; controller.direction = Direction::Right; }
+
+        Transform& transform = transforms.get(entity);
+        transform.position += movement;
+
+        // L'entité reste dans les limites de sa zone
+        if (colliders.has(entity)) {
+            const sf::FloatRect& limits = colliders.get(entity).limits;
+            const sf::Vector2f size = bounds.get(entity).size;
+            transform.position.x = std::clamp(transform.position.x, limits.position.x, limits.position.x + limits.size.x - size.x);
+            transform.position.y = std::clamp(transform.position.y, limits.position.y, limits.position.y + limits.size.y - size.y);
+        }
+    }
+}
+
+void World::updateBobs(sf::Time dt) {
+    const float step = dt.asSeconds() * 2.f;
+    for (std::size_t i = 0; i < bobs.size(); i++) {
+        Bob& bob = bobs[i];
+        if (!bob.active) continue;
+
+        bob.time += step;
+        transforms.get(bobs.getEntity(i)).offset = {
+            std::sin(bob.time * 0.5f) * bob.sway,
+            std::sin(bob.time) * bob.height
+        };
+    }
+}
+
+bool World::isInRange(Entity entity, const sf::FloatRect& playerBounds) const {
+    if (!interactables.has(entity)) return false;
+
+    // Zone d'interaction agrandie autour du corps : le centre du joueur doit y être
+    const float range = interactables.get(entity).range;
+    sf::FloatRect zone = getBounds(entity);
+    zone.position -= { range, range };
+    zone.size += { range * 2.f, range * 2.f };
+    return zone.contains(playerBounds.getCenter());
+}
+
+void World::draw(sf::RenderTarget& target, const std::vector<Entity>& entities) {
+    batch_.clear();
+    for (Entity entity : entities) {
+        if (!sprites.has(entity)) continue;
+        const Sprite& sprite = sprites.get(entity);
+        const sf::FloatRect rect = getBounds(entity);
+
+        if (sprite.shape == SpriteShape::Player) {
+            Direction direction = controllers.has(entity) ? controllers.get(entity).direction : Direction::Down;
+            appendPlayer(rect.position, direction);
+        }
+        else {
+            bool indicator = dialogues.has(entity) && !dialogues.get(entity).shown;
+            appendCharacter(rect.position, rect.size, sprite.color, indicator);
+        }
+    }
+
+    if (!batch_.empty()) {
+        DrawStats::draw(target, batch_.data(), batch_.size(), sf::PrimitiveType::Triangles);
+    }
+}
+
+void World::appendPlayer(sf::Vector2f pos, Direction direction) {
+    appendEllipse(pos + sf::Vector2f(20.f, 20.f), { 12.f, 12.f }, SKIN_COLOR);
+
+    // Épaules : cercles de rayon 9 aplatis selon la direction
+    const sf::Vector2f side(5.4f, 10.8f);
+    const sf::Vector2f front(10.8f, 5.4f);
+    switch (direction) {
+    case Direction::Right:
+    case Direction::Left:
+        appendEllipse(pos + sf::Vector2f(0.f, 14.f) + side, side, SHOULDER_COLOR);
+        appendEllipse(pos + sf::Vector2f(29.f, 14.f) + side, side, SHOULDER_COLOR);
+        break;
+    case Direction::Up:
+        appendEllipse(pos + sf::Vector2f(4.f, 20.f) + front, front, SHOULDER_COLOR);
+        appendEllipse(pos + sf::Vector2f(20.f, 20.f) + front, front, SHOULDER_COLOR);
+        break;
+    case Direction::Down:
+        appendEllipse(pos + sf::Vector2f(4.f, 16.f) + front, front, SHOULDER_COLOR);
+        appendEllipse(pos + sf::Vector2f(20.f, 16.f) + front, front, SHOULDER_COLOR);
+        break;
+    }
+
+    // Yeux (aucun de dos)
+    const sf::Vector2f eye(2.f, 2.f);
+    switch (direction) {
+    case Direction::Right:
+        appendEllipse(pos + sf::Vector2f(24.f, 14.f) + eye, eye, sf::Color::Black);
+        break;
+    case Direction::Left:
+        appendEllipse(pos + sf::Vector2f(14.f, 14.f) + eye, eye, sf::Color::Black);
+        break;
+    case Direction::Up:
+        break;
+    case Direction::Down:
+        appendEllipse(pos + sf::Vector2f(14.f, 16.f) + eye, eye, sf::Color::Black);
+        appendEllipse(pos + sf::Vector2f(24.f, 16.f) + eye, eye, sf::Color::Black);
+        break;
+    }
+}
+
+void World::appendCharacter(sf::Vector2f pos, sf::Vector2f size, sf::Color color, bool showIndicator) {
+    // Corps, tête, yeux
+    appendRect(pos, size, color);
+    appendEllipse(pos + sf::Vector2f(15.f, -5.f), { 10.f, 10.f }, SKIN_COLOR);
+    appendEllipse(pos + sf::Vector2f(12.f, -8.f), { 2.f, 2.f }, sf::Color::Black);
+    appendEllipse(pos + sf::Vector2f(20.f, -8.f), { 2.f, 2.f }, sf::Color::Black);
+
+    // Indicateur d'interaction (point jaune au-dessus si pas encore parlé)
+    if (showIndicator) {
+        appendEllipse(pos + sf::Vector2f(15.f, -25.f), { 5.f, 5.f }, sf::Color::Yellow);
+    }
+}
+
+void World::appendRect(sf::Vector2f pos, sf::Vector2f size, sf::Color color) {
+    const sf::Vector2f end = pos + size;
+    batch_.push_back({ { pos.x, pos.y }, color, {} });
+    batch_.push_back({ { end.x, pos.y }, color, {} });
+    batch_.push_back({ { pos.x, end.y }, color, {} });
+    batch_.push_back({ { pos.x, end.y }, color, {} });
+    batch_.push_back({ { end.x, pos.y }, color, {} });
+    batch_.push_back({ { end.x, end.y }, color, {} });
+}
+
+void World::appendEllipse(sf::Vector2f center, sf::Vector2f radius, sf::Color color) {
+    const std::size_t step = std::max(radius.x, radius.y) < SMALL_RADIUS ? SMALL_CIRCLE_STEP : 1;
+    for (std::size_t i = 0; i < CIRCLE_POINTS; i += step) {
+        const sf::Vector2f a = circle_[i];
+        const sf::Vector2f b = circle_[(i + step) % CIRCLE_POINTS];
+        batch_.push_back({ center, color, {} });
+        batch_.push_back({ { center.x + a.x * radius.x, center.y + a.y * radius.y }, color, {} });
+        batch_.push_back({ { center.x + b.x * radius.x, center.y + b.y * radius.y }, color, {} });
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "ComponentPool.hpp"
+
+enum class Direction { Right, Left, Up, Down };
+// Forme dessinée pour une entité
+enum class SpriteShape : std::uint8_t { Player, Character };
+
+// Composants : de simples données, le comportement est dans les systèmes de World
+struct Transform {
+    sf::Vector2f position;  // Position de base
+    sf::Vector2f offset;    // Décalage d'animation (balancement)
+};
+struct Bounds {
+    sf::Vector2f size;      // Rectangle de collision à partir de position + offset
+};
+struct Sprite {
+    SpriteShape shape;
+    sf::Color color;        // Couleur du corps (Character)
+};
+struct Bob {
+    float time;
+    float height;           // Amplitude verticale
+    float sway;             // Amplitude horizontale (va-et-vient des manifestants)
+    bool active;            // Animé seulement dans un chunk chargé de la zone courante
+};
+struct Dialogue {
+    std::uint32_t entry;    // Point d'entrée dans le script de dialogues
+    std::uint8_t speaker;   // Indice du nom affiché (voir SPEAKER_KEYS)
+    bool shown;             // Déjà parlé : plus d'indicateur au-dessus de la tête
+};
+struct Interactable {
+    float range;            // Marge autour du corps dans laquelle on peut parler
+};
+struct Collider {
+    sf::FloatRect limits;   // L'entité reste dans ce rectangle (la zone)
+};
+struct Controller {
+    float speed;
+    Direction direction;
+};
+// Comportement d'un NPC qui se déplace (voir AgentSystem)
+enum class AgentBehavior : std::uint8_t { Idle, Wander, Follow, Queue };
+struct Agent {
+    AgentBehavior behavior;
+    float speed;
+    sf::Vector2f home;      // Centre de la zone d'errance (et point de retour hors de la file)
+    float radius;           // Rayon d'errance
+    Entity target;          // Entité suivie (Follow)
+    std::uint32_t queue;    // File d'attente (Queue)
+    bool inQueue;           // A rejoint la file (sinon revient de l'embarquement)
+    std::uint32_t ticket;   // Demande de chemin en cours (PathService), sinon 0xFFFFFFFF
+    sf::Vector2f goal;      // Destination du chemin en cours
+    std::vector<sf::Vector2f> path; // Points de passage restants (centre du corps)
+    std::uint32_t next;
+    float wait;             // Attente avant de repartir, en secondes
+};
+
+// Touches de déplacement enfoncées cette frame
+struct MoveInput {
+    bool up, down, left, right;
+};
+
+// Entités du jeu (joueur, NPCs) : un identifiant et des composants rangés
+// dans des tableaux denses. Les systèmes parcourent ces tableaux dans
+// l'ordre, sans appel virtuel ; tous les personnages visibles sont
+// dessinés en un seul appel.
+class World {
+public:
+    World();
+
+    Entity create();
+    // Retire tous les composants de l'entité (son identifiant n'est pas réutilisé)
+    void destroy(Entity entity);
+    void clear();
+    std::size_t getEntityCount() const { return next_; }
+
+    sf::FloatRect getBounds(Entity entity) const;
+    sf::Vector2f getPosition(Entity entity) const { return transforms.get(entity).position; }
+    void setPosition(Entity entity, sf::Vector2f position);
+
+    // Systèmes
+    void updateControllers(sf::Time dt, const MoveInput& input);
+    void updateBobs(sf::Time dt);
+    bool isInRange(Entity entity, const sf::FloatRect& playerBounds) const;
+    void draw(sf::RenderTarget& target, const std::vector<Entity>& entities);
+
+    ComponentPool<Transform> transforms;
+    ComponentPool<Bounds> bounds;
+    ComponentPool<Sprite> sprites;
+    ComponentPool<Bob> bobs;
+    ComponentPool<Dialogue> dialogues;
+    ComponentPool<Interactable> interactables;
+    ComponentPool<Collider> colliders;
+    ComponentPool<Controller> controllers;
+    ComponentPool<Agent> agents;
+
+private:
+    void appendPlayer(sf::Vector2f pos, Direction direction);
+    void appendCharacter(sf::Vector2f pos, sf::Vector2f size, sf::Color color, bool showIndicator);
+    void appendRect(sf::Vector2f pos, sf::Vector2f size, sf::Color color);
+    void appendEllipse(sf::Vector2f center, sf::Vector2f radius, sf::Color color);
+
+    Entity next_;
+    std::vector<sf::Vector2f> circle_;  // Cercle unité, calculé une fois
+    std::vector<sf::Vertex> batch_;     // Sommets de la frame (capacité gardée)
+};
@@ -0,0 +1,327 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include "AllocTracker.hpp"
+#include "DrawStats.hpp"
+#include "PlayScript.hpp"
+
+// Tests de performance : des parties scriptées (voir PlayScript) traversent
+// toutes les zones, du menu au générique. Pour chaque zone on mesure la
+// durée des frames (percentiles), les allocations du thread principal
+// (AllocTracker, si NOLAN_ALLOC_TRACKING) et
+// les appels de dessin (avec --render), puis on compare à une référence :
+// une mesure qui dépasse sa tolérance fait échouer le test (et la
+// construction avec NOLAN_PERF_GATE).
+//   nolan_perf [--render] [--repeat N] [--baseline FICHIER] [--update | --update-timings]
+//              [--session FICHIER] [--assets DOSSIER] script...
+// --render    dessine chaque frame dans une texture (sinon : logique seule,
+//             aucun appel de dessin, et draws_per_frame n'est pas mesuré)
+// --update    réécrit la référence avec les mesures, sauf les durées déjà
+//             présentes (elles ne valent que pour la machine de mesure)
+// --update-timings  réécrit aussi les durées
+// --session   enregistre les frames jouées (nolan_sim, entraînement du PGO)
+// --assets    dossier qui contient assets/ (sinon le dossier courant) ; les
+//             autres fichiers et la sauvegarde de simulation restent relatifs
+//             au dossier de lancement
+
+namespace {
+    const sf::Vector2u RENDER_SIZE(800, 600);
+
+    struct AreaStats {
+        std::vector<float> frameMicros;
+        std::uint64_t allocations = 0;
+        std::uint64_t allocatingFrames = 0;  // Frames qui ont alloué au moins une fois
+        std::uint64_t bytes = 0;
+        std::uint64_t draws = 0;
+    };
+
+    // Marge d'une mesure : valeur > référence * (1 + ratio) + slack
+    struct Tolerance {
+        float ratio;
+        float slack;
+    };
+
+    using Metrics = std::map<std::string, std::map<std::string, float>>; // Zone -> mesure -> valeur
+
+    bool isTiming(const std::string& metric) {
+        return metric.size() > 3 && metric.compare(metric.size() - 3, 3, "_us") == 0;
+    }
+
+    // Les durées varient d'une exécution à l'autre, les compteurs presque pas
+    Tolerance defaultTolerance(const std::string& metric) {
+        if (isTiming(metric)) return { 0.5f, 20.f };
+        return { 0.1f, 0.5f };
+    }
+
+    std::string getLabel(const Game& game) {
+        switch (game.getState()) {
+        case GameState::Menu: return "menu";
+        case GameState::Credits: return "credits";
+        default: return game.getCurrentArea();
+        }
+    }
+
+    float percentile(std::vector<float> samples, float p) {
+        if (samples.empty()) return 0.f;
+        std::sort(samples.begin(), samples.end());
+        std::size_t rank = static_cast<std::size_t>(p * static_cast<float>(samples.size() - 1) + 0.5f);
+        return samples[rank];
+    }
+
+    // Une partie, sur un jeu neuf ; faux si le script échoue
+    bool play(const std::string& path, const std::string& savePath, sf::RenderTexture* target,
+              std::map<std::string, AreaStats>& stats, std::vector<std::string>& order, InputSession* session) {
+        using Clock = std::chrono::steady_clock;
+
+        PlayScript script;
+        if (!script.load(path)) return false;
+        Game game(true, savePath);
+        if (target) game.setRenderSize(target->getSize());
+
+        SessionFrame frame;
+        while (script.next(game, frame)) {
+            const std::string label = getLabel(game);
+            const std::uint64_t allocations = AllocTracker::getThreadCount();
+            const std::uint64_t bytes = AllocTracker::getThreadBytes();
+            DrawStats::reset();
+
+            const Clock::time_point start = Clock::now();
+            game.simulateFrame(frame);
+            if (target) game.renderTo(*target);
+            const float micros = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+
+            auto [it, added] = stats.try_emplace(label);
+            if (added) order.push_back(label);
+            AreaStats& area = it->second;
+            area.frameMicros.push_back(micros);
+            const std::uint64_t frameAllocations = AllocTracker::getThreadCount() - allocations;
+            area.allocations += frameAllocations;
+            if (frameAllocations > 0) area.allocatingFrames++;
+            area.bytes += AllocTracker::getThreadBytes() - bytes;
+            area.draws += DrawStats::getCalls();
+            if (session) session->add(frame);
+        }
+
+        if (!script.getError().empty()) {
+            std::cerr << "Partie interrompue : " << script.getError() << "\n";
+            return false;
+        }
+        return true;
+    }
+
+    bool loadBaseline(const std::string& path, Metrics& baseline, std::map<std::string, Tolerance>& tolerances) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "Référence introuvable : " << path << "\n";
+            return false;
+        }
+        std::string line;
+        while (std::getline(file, line)) {
+            std::istringstream in(line);
+            std::string first, metric;
+            if (!(in >> first) || first[0] == '#') continue;
+            if (first == "tolerance") {
+                Tolerance tolerance;
+                if (in >> metric >> tolerance.ratio >> tolerance.slack) tolerances[metric] = tolerance;
+                continue;
+            }
+            float value;
+            if (in >> metric >> value) baseline[first][metric] = value;
+        }
+        return true;
+    }
+
+    bool saveBaseline(const std::string& path, const Metrics& metrics, const std::vector<std::string>& order,
+                      const std::map<std::string, Tolerance>& tolerances) {
+        std::ofstream file(path);
+        if (!file) {
+            std::cerr << "Impossible d'écrire la référence : " << path << "\n";
+            return false;
+        }
+        file << "# Référence des tests de performance (nolan_perf --update)\n";
+        file << "# tolerance <mesure> <ratio> <marge> : échec si valeur > référence * (1 + ratio) + marge\n";
+        for (const auto& [metric, tolerance] : tolerances) {
+            file << "tolerance " << metric << " " << tolerance.ratio << " " << tolerance.slack << "\n";
+        }
+        file << "# <zone> <mesure> <valeur>\n" << std::fixed << std::setprecision(2);
+        for (const std::string& label : order) {
+            for (const auto& [metric, value] : metrics.at(label)) {
+                file << label << " " << metric << " " << value << "\n";
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> scripts;
+    std::string baselinePath, sessionPath, assetsPath;
+    bool render = false, update = false, updateTimings = false;
+    int repeat = 1;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--render") == 0) render = true;
+        else if (std::strcmp(argv[i], "--update") == 0) update = true;
+        else if (std::strcmp(argv[i], "--update-timings") == 0) update = updateTimings = true;
+        else if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) repeat = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) baselinePath = argv[++i];
+        else if (std::strcmp(argv[i], "--session") == 0 && i + 1 < argc) sessionPath = argv[++i];
+        else if (std::strcmp(argv[i], "--assets") == 0 && i + 1 < argc) assetsPath = argv[++i];
+        else scripts.push_back(argv[i]);
+    }
+    if (scripts.empty()) {
+        std::cerr << "Usage : nolan_perf [--render] [--repeat N] [--baseline FICHIER] [--update | --update-timings] [--session FICHIER] [--assets DOSSIER] script...\n";
+        return 2;
+    }
+
+    // Les chemins du jeu sont relatifs au dossier courant : on s'y place
+    // après avoir fixé ceux des fichiers donnés et de la sauvegarde
+    std::string savePath;
+    if (!assetsPath.empty()) {
+        auto makeAbsolute = [](std::string& path) {
+            if (!path.empty()) path = std::filesystem::absolute(path).string();
+        };
+        makeAbsolute(baselinePath);
+        makeAbsolute(sessionPath);
+        for (std::string& script : scripts) makeAbsolute(script);
+        savePath = std::filesystem::absolute("nolan_sim.sav").string();
+
+        std::error_code error;
+        std::filesystem::current_path(assetsPath, error);
+        if (error) {
+            std::cerr << "Dossier des assets introuvable : " << assetsPath << "\n";
+            return 2;
+        }
+    }
+
+    std::optional<sf::RenderTexture> target;
+    if (render) {
+        target.emplace();
+        if (!target->resize(RENDER_SIZE)) {
+            std::cerr << "Impossible de créer la texture de rendu\n";
+            return 2;
+        }
+    }
+
+    // Toutes les parties, repeat fois (les frames s'ajoutent par zone)
+    std::map<std::string, AreaStats> stats;
+    std::vector<std::string> order;
+    InputSession session;
+    for (int run = 0; run < repeat; run++) {
+        for (const std::string& script : scripts) {
+            InputSession* recorded = run == 0 && !sessionPath.empty() ? &session : nullptr;
+            if (!play(script, savePath, target ? &*target : nullptr, stats, order, recorded)) return 2;
+        }
+    }
+    if (!sessionPath.empty() && !session.save(sessionPath)) return 2;
+
+    Metrics metrics;
+    std::cout << std::left << std::setw(18) << "zone" << std::right
+              << std::setw(8) << "frames" << std::setw(10) << "p50 us" << std::setw(10) << "p95 us" << std::setw(10) << "p99 us"
+              << std::setw(10) << "alloc/f" << std::setw(12) << "octets/f" << std::setw(10) << "%f alloc"
+              << std::setw(10) << "draw/f" << "\n";
+    for (const std::string& label : order) {
+        const AreaStats& area = stats.at(label);
+        const float frames = static_cast<float>(area.frameMicros.size());
+        std::map<std::string, float>& values = metrics[label];
+        values["p50_us"] = percentile(area.frameMicros, 0.50f);
+        values["p95_us"] = percentile(area.frameMicros, 0.95f);
+        values["p99_us"] = percentile(area.frameMicros, 0.99f);
+        const float draws = static_cast<float>(area.draws) / frames;
+        // Sans rendu, aucun appel de dessin : rien à comparer
+        if (render) values["draws_per_frame"] = draws;
+        const float allocations = static_cast<float>(area.allocations) / frames;
+        const float bytes = static_cast<float>(area.bytes) / frames;
+        // Part des frames qui allouent : les autres sont le régime établi, à zéro allocation
+        const float allocating = static_cast<float>(area.allocatingFrames) * 100.f / frames;
+        // Sans suivi des allocations, ces mesures ne sont pas comparées
+        if (AllocTracker::isEnabled()) {
+            values["allocs_per_frame"] = allocations;
+            values["bytes_per_frame"] = bytes;
+            values["allocating_frames_pct"] = allocating;
+        }
+
+        std::cout << std::left << std::setw(18) << label << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << area.frameMicros.size() << std::setw(10) << values["p50_us"]
+                  << std::setw(10) << values["p95_us"] << std::setw(10) << values["p99_us"]
+                  << std::setw(10) << allocations << std::setw(12) << bytes << std::setw(10) << allocating
+                  << std::setw(10) << draws << "\n";
+    }
+
+    // Mémoire par sous-système, tous threads confondus (pic : octets alloués au pire moment)
+    if (AllocTracker::isEnabled()) {
+        std::cout << "\n" << std::left << std::setw(18) << "sous-systeme" << std::right
+                  << std::setw(12) << "allocs" << std::setw(14) << "octets" << std::setw(12) << "pic Ko" << "\n";
+        for (std::size_t i = 0; i < static_cast<std::size_t>(AllocTag::Count); i++) {
+            const AllocStats tag = AllocTracker::getStats(static_cast<AllocTag>(i));
+            if (tag.count == 0) continue;
+            std::cout << std::left << std::setw(18) << AllocTracker::getTagName(static_cast<AllocTag>(i)) << std::right
+                      << std::setw(12) << tag.count << std::setw(14) << tag.bytes
+                      << std::setw(12) << static_cast<float>(tag.peak) / 1024.f << "\n";
+        }
+    }
+    else {
+        std::cerr << "Allocations non suivies (NOLAN_ALLOC_TRACKING) : non comparées\n";
+    }
+    if (baselinePath.empty()) return 0;
+
+    Metrics baseline;
+    std::map<std::string, Tolerance> tolerances;
+    const bool hasBaseline = loadBaseline(baselinePath, baseline, tolerances);
+    if (update) {
+        // Durées de la référence gardées : un changement du jeu ne les déplace pas
+        if (!updateTimings) {
+            for (auto& [label, values] : metrics) {
+                auto previous = baseline.find(label);
+                if (previous == baseline.end()) continue;
+                for (auto& [metric, value] : values) {
+                    auto reference = previous->second.find(metric);
+                    if (isTiming(metric) && reference != previous->second.end()) value = reference->second;
+                }
+            }
+        }
+        if (!saveBaseline(baselinePath, metrics, order, tolerances)) return 2;
+        std::cout << "Référence mise à jour : " << baselinePath << "\n";
+        return 0;
+    }
+    if (!hasBaseline) return 2;
+    if (baseline.empty()) {
+        std::cerr << "Référence vide : " << baselinePath << " (la créer avec --update)\n";
+        return 2;
+    }
+
+    // Chaque mesure de la référence doit rester dans sa tolérance
+    int regressions = 0;
+    for (const auto& [label, values] : baseline) {
+        auto measured = metrics.find(label);
+        if (measured == metrics.end()) {
+            std::cerr << "REGRESSION " << label << " : zone non traversée\n";
+            regressions++;
+            continue;
+        }
+        for (const auto& [metric, reference] : values) {
+            auto value = measured->second.find(metric);
+            if (value == measured->second.end()) continue;
+            auto custom = tolerances.find(metric);
+            const Tolerance tolerance = custom != tolerances.end() ? custom->second : defaultTolerance(metric);
+            const float limit = reference * (1.f + tolerance.ratio) + tolerance.slack;
+            if (value->second > limit) {
+                std::cerr << "REGRESSION " << label << " " << metric << " : " << value->second
+                          << " (référence " << reference << ", limite " << limit << ")\n";
+                regressions++;
+            }
+        }
+    }
+    if (regressions > 0) {
+        std::cerr << regressions << " mesure(s) au-delà de la référence " << baselinePath << "\n";
+        return 1;
+    }
+    std::cout << "Mesures dans les tolérances de " << baselinePath << "\n";
+    return 0;
+}
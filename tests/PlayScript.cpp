@@ -0,0 +1,209 @@
+#include "PlayScript.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+namespace {
+    // Dans l'ordre de l'enum Action
+    const char* const ACTION_NAMES[] = {
+        "MoveUp", "MoveDown", "MoveLeft", "MoveRight", "Interact",
+        "Choice1", "Choice2", "Choice3", "Choice4", "Confirm", "Pause",
+        "Language", "QuickSave", "QuickLoad", "Rewind", "RewindFast",
+        "DebugOverlay"
+    };
+    static_assert(std::size(ACTION_NAMES) == static_cast<std::size_t>(Action::Count), "ACTION_NAMES incomplet");
+
+    const char* const STATE_NAMES[] = { "menu", "playing", "paused", "credits" };
+
+    const float WALK_TOLERANCE = 4.f;   // Un peu plus qu'un pas (200 px/s à 60 images/s)
+    const float DEFAULT_WALK_TIME = 15.f;
+    const float DEFAULT_WAIT_TIME = 5.f;
+    const float DEFAULT_TALK_TIME = 30.f;
+    const int TALK_START_FRAMES = 30;   // Sans dialogue ouvert après ça : personne à portée
+
+    bool parseAction(const std::string& name, InputMap::ActionSet& actions) {
+        for (std::size_t i = 0; i < std::size(ACTION_NAMES); i++) {
+            if (name == ACTION_NAMES[i]) {
+                actions |= InputMap::bit(static_cast<Action>(i));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Délai facultatif en fin de ligne
+    void readSeconds(std::istringstream& in, float& seconds) {
+        float value;
+        if (in >> value) seconds = value;
+    }
+
+    int toFrames(float seconds) {
+        return static_cast<int>(std::lround(seconds * 1000000.f / static_cast<float>(PlayScript::FRAME_MICROSECONDS)));
+    }
+}
+
+PlayScript::PlayScript()
+    : current_(0)
+    , frames_(0)
+    , talked_(false)
+{
+}
+
+bool PlayScript::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Impossible d'ouvrir le script : " << path << "\n";
+        return false;
+    }
+
+    name_ = path;
+    commands_.clear();
+    current_ = 0;
+    frames_ = 0;
+    error_.clear();
+
+    bool ok = true;
+    int lineNumber = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        std::istringstream in(line);
+        std::string keyword;
+        if (!(in >> keyword) || keyword[0] == '#') continue;
+
+        Command command{ Kind::Wait, 0, { 0.f, 0.f }, 0.f, {}, lineNumber };
+        bool valid = true;
+        std::string word;
+        if (keyword == "wait") {
+            valid = static_cast<bool>(in >> command.seconds);
+        }
+        else if (keyword == "press" || keyword == "hold") {
+            command.kind = keyword == "press" ? Kind::Press : Kind::Hold;
+            if (command.kind == Kind::Hold) valid = static_cast<bool>(in >> command.seconds);
+            while (valid && in >> word) valid = parseAction(word, command.actions);
+            valid = valid && command.actions != 0;
+        }
+        else if (keyword == "click" || keyword == "walk") {
+            command.kind = keyword == "click" ? Kind::Click : Kind::Walk;
+            command.seconds = DEFAULT_WALK_TIME;
+            valid = static_cast<bool>(in >> command.position.x >> command.position.y);
+            if (command.kind == Kind::Walk) readSeconds(in, command.seconds);
+        }
+        else if (keyword == "area" || keyword == "state") {
+            command.kind = keyword == "area" ? Kind::Area : Kind::State;
+            command.seconds = DEFAULT_WAIT_TIME;
+            valid = static_cast<bool>(in >> command.name);
+            if (valid && command.kind == Kind::State) {
+                valid = std::find(std::begin(STATE_NAMES), std::end(STATE_NAMES), command.name) != std::end(STATE_NAMES);
+            }
+            readSeconds(in, command.seconds);
+        }
+        else if (keyword == "talk") {
+            command.kind = Kind::Talk;
+            command.seconds = DEFAULT_TALK_TIME;
+            readSeconds(in, command.seconds);
+        }
+        else {
+            valid = false;
+        }
+
+        if (!valid) {
+            std::cerr << path << ":" << lineNumber << " : commande invalide\n";
+            ok = false;
+            continue;
+        }
+        commands_.push_back(command);
+    }
+    return ok;
+}
+
+bool PlayScript::fail(const Command& command, const std::string& message) {
+    std::ostringstream out;
+    out << name_ << ":" << command.line << " : " << message << " (zone " << startArea_ << ")";
+    error_ = out.str();
+    return false;
+}
+
+bool PlayScript::next(const Game& game, SessionFrame& frame) {
+    while (current_ < commands_.size() && error_.empty()) {
+        frame = { sf::microseconds(FRAME_MICROSECONDS), 0, 0, std::nullopt };
+        if (frames_ == 0) {
+            startArea_ = game.getCurrentArea();
+            talked_ = false;
+        }
+        if (step(game, commands_[current_], frame)) {
+            frames_++;
+            return true;
+        }
+        current_++;
+        frames_ = 0;
+    }
+    return false;
+}
+
+bool PlayScript::step(const Game& game, const Command& command, SessionFrame& frame) {
+    const int frames = toFrames(command.seconds);
+    switch (command.kind) {
+    case Kind::Wait:
+        return frames_ < frames;
+
+    case Kind::Press:
+        // Appui, puis une frame relâchée : deux press de suite font deux appuis
+        if (frames_ == 0) {
+            frame.down = command.actions;
+            frame.pressed = command.actions;
+        }
+        return frames_ < 2;
+
+    case Kind::Hold:
+        if (frames_ >= frames) return false;
+        frame.down = command.actions;
+        frame.pressed = frames_ == 0 ? command.actions : 0;
+        return true;
+
+    case Kind::Click:
+        if (frames_ > 0) return false;
+        frame.click = command.position;
+        return true;
+
+    case Kind::Walk: {
+        if (game.getCurrentArea() != startArea_ || game.getState() != GameState::Playing) return false;
+        const sf::Vector2f delta = command.position - game.getPlayerPosition();
+        if (std::abs(delta.x) <= WALK_TOLERANCE && std::abs(delta.y) <= WALK_TOLERANCE) return false;
+        if (frames_ >= frames) {
+            const sf::Vector2f player = game.getPlayerPosition();
+            return fail(command, "position non atteinte, joueur en " + std::to_string(std::lround(player.x)) + " " + std::to_string(std::lround(player.y)));
+        }
+        if (delta.x > WALK_TOLERANCE) frame.down |= InputMap::bit(Action::MoveRight);
+        if (delta.x < -WALK_TOLERANCE) frame.down |= InputMap::bit(Action::MoveLeft);
+        if (delta.y > WALK_TOLERANCE) frame.down |= InputMap::bit(Action::MoveDown);
+        if (delta.y < -WALK_TOLERANCE) frame.down |= InputMap::bit(Action::MoveUp);
+        frame.pressed = frames_ == 0 ? frame.down : 0;
+        return true;
+    }
+
+    case Kind::Area:
+        if (game.getCurrentArea() == command.name) return false;
+        return frames_ < frames || fail(command, "zone " + command.name + " non atteinte");
+
+    case Kind::State:
+        if (command.name == STATE_NAMES[static_cast<std::size_t>(game.getState())]) return false;
+        return frames_ < frames || fail(command, "écran " + command.name + " non atteint");
+
+    case Kind::Talk:
+        // Interagir une frame sur deux (et premier choix aux questions)
+        if (game.isDialogueShown()) talked_ = true;
+        else if (talked_) return false;
+        if (!talked_ && frames_ >= TALK_START_FRAMES) return fail(command, "aucun NPC à portée");
+        if (frames_ >= frames) return fail(command, "dialogue sans fin");
+        if (frames_ % 2 == 0) {
+            frame.down = InputMap::bit(Action::Interact) | InputMap::bit(Action::Choice1);
+            frame.pressed = frame.down;
+        }
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Game.hpp"
+
+// Partie scriptée : le jeu est piloté par ses actions, comme par un joueur,
+// et le script regarde l'état du jeu (zone, écran, position du joueur,
+// dialogue) pour savoir quand passer à la commande suivante. Chaque frame
+// dure 1/60 s : la même partie se rejoue à l'identique.
+//
+// Une commande par ligne (# : commentaire) ; secondes = délai maximal
+// pour les commandes qui attendent quelque chose :
+//   wait <secondes>                  rien pendant ce temps
+//   press <action>...                appui d'une frame
+//   hold <secondes> <action>...      actions maintenues
+//   click <x> <y>                    clic sur un bouton (coordonnées de la vue)
+//   walk <x> <y> [secondes]          marche jusqu'à cette position (coin haut-gauche
+//                                    du joueur) ; s'arrête aussi en changeant de zone
+//                                    ou d'écran (générique)
+//   area <zone> [secondes]           attend d'être dans cette zone
+//   state <menu|playing|paused|credits> [secondes]
+//   talk [secondes]                  parle au NPC à portée jusqu'à la fin du
+//                                    dialogue (premier choix à chaque question)
+// Actions : les noms de l'enum Action (MoveUp, Interact, Confirm...).
+class PlayScript {
+public:
+    static constexpr std::int64_t FRAME_MICROSECONDS = 16667;
+
+    PlayScript();
+
+    bool load(const std::string& path);
+
+    // Remplit frame avec la prochaine frame à jouer, d'après l'état du jeu.
+    // Faux à la fin du script, ou si une commande a échoué (voir getError)
+    bool next(const Game& game, SessionFrame& frame);
+    const std::string& getError() const { return error_; }
+    const std::string& getName() const { return name_; }
+
+private:
+    enum class Kind { Wait, Press, Hold, Click, Walk, Area, State, Talk };
+    struct Command {
+        Kind kind;
+        InputMap::ActionSet actions;
+        sf::Vector2f position;
+        float seconds;
+        std::string name;
+        int line;
+    };
+
+    // Faux : la commande est finie, on passe à la suivante
+    bool step(const Game& game, const Command& command, SessionFrame& frame);
+    bool fail(const Command& command, const std::string& message);
+
+    std::string name_;
+    std::vector<Command> commands_;
+    std::size_t current_;
+    int frames_;                // Frames jouées par la commande courante
+    std::string startArea_;     // Walk : zone au début de la marche
+    bool talked_;               // Talk : le dialogue s'est ouvert
+    std::string error_;
+};